@@ -1 +0,0 @@
-# Intentionally empty
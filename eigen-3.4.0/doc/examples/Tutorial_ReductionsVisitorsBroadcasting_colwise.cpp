@@ -1,13 +0,0 @@
-#include <iostream>
-#include <Eigen/Dense>
-
-using namespace std;
-int main()
-{
-  Eigen::MatrixXf mat(2,4);
-  mat << 1, 2, 6, 9,
-         3, 1, 7, 2;
-  
-  std::cout << "Column's maximum: " << std::endl
-   << mat.colwise().maxCoeff() << std::endl;
-}
@@ -1,26 +0,0 @@
-#include <iostream>
-#include <Eigen/Dense>
-
-using namespace std;
-using namespace Eigen;
-
-int main()
-{
-  Eigen::MatrixXf m(2,2);
-  
-  m << 1, 2,
-       3, 4;
-
-  //get location of maximum
-  MatrixXf::Index maxRow, maxCol;
-  float max = m.maxCoeff(&maxRow, &maxCol);
-
-  //get location of minimum
-  MatrixXf::Index minRow, minCol;
-  float min = m.minCoeff(&minRow, &minCol);
-
-  cout << "Max: " << max <<  ", at: " <<
-     maxRow << "," << maxCol << endl;
-  cout << "Min: " << min << ", at: " <<
-     minRow << "," << minCol << endl;
-}
@@ -1,2 +0,0 @@
-Array<int, Dynamic, 1> v {{1, 2, 3, 4, 5}};
-cout << v << endl;
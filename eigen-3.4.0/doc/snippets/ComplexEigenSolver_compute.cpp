@@ -1,16 +0,0 @@
-MatrixXcf A = MatrixXcf::Random(4,4);
-cout << "Here is a random 4x4 matrix, A:" << endl << A << endl << endl;
-
-ComplexEigenSolver<MatrixXcf> ces;
-ces.compute(A);
-cout << "The eigenvalues of A are:" << endl << ces.eigenvalues() << endl;
-cout << "The matrix of eigenvectors, V, is:" << endl << ces.eigenvectors() << endl << endl;
-
-complex<float> lambda = ces.eigenvalues()[0];
-cout << "Consider the first eigenvalue, lambda = " << lambda << endl;
-VectorXcf v = ces.eigenvectors().col(0);
-cout << "If v is the corresponding eigenvector, then lambda * v = " << endl << lambda * v << endl;
-cout << "... and A * v = " << endl << A * v << endl << endl;
-
-cout << "Finally, V * D * V^(-1) = " << endl
-     << ces.eigenvectors() * ces.eigenvalues().asDiagonal() * ces.eigenvectors().inverse() << endl;
@@ -1,4 +0,0 @@
-MatrixXcf ones = MatrixXcf::Ones(3,3);
-ComplexEigenSolver<MatrixXcf> ces(ones, /* computeEigenvectors = */ false);
-cout << "The eigenvalues of the 3x3 matrix of ones are:" 
-     << endl << ces.eigenvalues() << endl;
@@ -1,4 +0,0 @@
-MatrixXcf A = MatrixXcf::Random(4,4);
-cout << "Here is a random 4x4 matrix, A:" << endl << A << endl << endl;
-ComplexSchur<MatrixXcf> schurOfA(A);
-cout << "The unitary matrix U is:" << endl << schurOfA.matrixU() << endl;
@@ -1,3 +0,0 @@
-ArrayXcf v = ArrayXcf::Random(3);
-cout << v << endl << endl;
-cout << arg(v) << endl;
@@ -1,2 +0,0 @@
-Array3d v(2,3,4);
-cout << v.cube() << endl;
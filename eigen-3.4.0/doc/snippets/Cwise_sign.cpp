@@ -1,2 +0,0 @@
-Array3d v(-3,5,0);
-cout << v.sign() << endl;
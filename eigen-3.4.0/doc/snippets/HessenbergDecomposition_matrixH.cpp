@@ -1,8 +0,0 @@
-Matrix4f A = MatrixXf::Random(4,4);
-cout << "Here is a random 4x4 matrix:" << endl << A << endl;
-HessenbergDecomposition<MatrixXf> hessOfA(A);
-MatrixXf H = hessOfA.matrixH();
-cout << "The Hessenberg matrix H is:" << endl << H << endl;
-MatrixXf Q = hessOfA.matrixQ();
-cout << "The orthogonal matrix Q is:" << endl << Q << endl;
-cout << "Q H Q^T is:" << endl << Q * H * Q.transpose() << endl;
@@ -1,3 +0,0 @@
-int array[9];
-for(int i = 0; i < 9; ++i) array[i] = i;
-cout << Map<Matrix3i>(array) << endl;
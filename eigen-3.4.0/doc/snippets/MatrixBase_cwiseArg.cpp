@@ -1,3 +0,0 @@
-MatrixXcf v = MatrixXcf::Random(2, 3);
-cout << v << endl << endl;
-cout << v.cwiseArg() << endl;
\ No newline at end of file
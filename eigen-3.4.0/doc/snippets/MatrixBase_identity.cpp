@@ -1 +0,0 @@
-cout << Matrix<double, 3, 4>::Identity() << endl;
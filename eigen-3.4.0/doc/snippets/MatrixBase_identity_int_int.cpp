@@ -1 +0,0 @@
-cout << MatrixXd::Identity(4, 3) << endl;
@@ -1,2 +0,0 @@
-cout << Matrix2d::Ones() << endl;
-cout << 6 * RowVector4i::Ones() << endl;
@@ -1,2 +0,0 @@
-cout << 6 * RowVectorXi::Ones(4) << endl;
-cout << VectorXf::Ones(2) << endl;
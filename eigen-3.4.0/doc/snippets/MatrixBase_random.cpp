@@ -1 +0,0 @@
-cout << 100 * Matrix2i::Random() << endl;
@@ -1,3 +0,0 @@
-Matrix4i m = Matrix4i::Random();
-cout << "Here is the matrix m:" << endl << m << endl;
-cout << "Here is m.reshaped(2, 8):" << endl << m.reshaped(2, 8) << endl;
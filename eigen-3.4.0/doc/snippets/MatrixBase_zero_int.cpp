@@ -1,2 +0,0 @@
-cout << RowVectorXi::Zero(4) << endl;
-cout << VectorXf::Zero(2) << endl;
@@ -1,5 +0,0 @@
-MatrixXd m {
-  {1, 2, 3},
-  {4, 5, 6}
-};
-cout << m << endl;
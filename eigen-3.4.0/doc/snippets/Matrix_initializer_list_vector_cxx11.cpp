@@ -1,2 +0,0 @@
-VectorXi v {{1, 2}};
-cout << v << endl;
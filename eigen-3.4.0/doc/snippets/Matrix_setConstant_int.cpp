@@ -1,3 +0,0 @@
-VectorXf v;
-v.setConstant(3, 5);
-cout << v << endl;
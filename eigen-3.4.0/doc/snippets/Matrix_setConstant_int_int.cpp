@@ -1,3 +0,0 @@
-MatrixXf m;
-m.setConstant(3, 3, 5);
-cout << m << endl;
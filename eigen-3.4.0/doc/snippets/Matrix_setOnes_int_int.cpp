@@ -1,3 +0,0 @@
-MatrixXf m;
-m.setOnes(3, 3);
-cout << m << endl;
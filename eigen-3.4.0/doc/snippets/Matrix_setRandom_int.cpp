@@ -1,3 +0,0 @@
-VectorXf v;
-v.setRandom(3);
-cout << v << endl;
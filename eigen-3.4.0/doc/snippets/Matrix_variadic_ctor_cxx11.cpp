@@ -1,3 +0,0 @@
-Matrix<int, 1, 6> a(1, 2, 3, 4, 5, 6);
-Matrix<int, 3, 1> b {1, 2, 3};
-cout << a << "\n\n" << b << endl;
@@ -1,10 +0,0 @@
-MatrixXd A = MatrixXd::Random(6,6);
-cout << "Here is a random 6x6 matrix, A:" << endl << A << endl << endl;
-
-RealSchur<MatrixXd> schur(A);
-cout << "The orthogonal matrix U is:" << endl << schur.matrixU() << endl;
-cout << "The quasi-triangular matrix T is:" << endl << schur.matrixT() << endl << endl;
-
-MatrixXd U = schur.matrixU();
-MatrixXd T = schur.matrixT();
-cout << "U * T * U^T = " << endl << U * T * U.transpose() << endl;
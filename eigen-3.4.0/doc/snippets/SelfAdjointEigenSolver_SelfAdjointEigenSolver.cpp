@@ -1,7 +0,0 @@
-SelfAdjointEigenSolver<Matrix4f> es;
-Matrix4f X = Matrix4f::Random(4,4);
-Matrix4f A = X + X.transpose();
-es.compute(A);
-cout << "The eigenvalues of A are: " << es.eigenvalues().transpose() << endl;
-es.compute(A + Matrix4f::Identity(4,4)); // re-use es to compute eigenvalues of A+I
-cout << "The eigenvalues of A+I are: " << es.eigenvalues().transpose() << endl;
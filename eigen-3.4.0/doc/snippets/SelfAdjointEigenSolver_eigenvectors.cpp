@@ -1,4 +0,0 @@
-MatrixXd ones = MatrixXd::Ones(3,3);
-SelfAdjointEigenSolver<MatrixXd> es(ones);
-cout << "The first eigenvector of the 3x3 matrix of ones is:" 
-     << endl << es.eigenvectors().col(0) << endl;
@@ -1,9 +0,0 @@
-Tridiagonalization<MatrixXf> tri;
-MatrixXf X = MatrixXf::Random(4,4);
-MatrixXf A = X + X.transpose();
-tri.compute(A);
-cout << "The matrix T in the tridiagonal decomposition of A is: " << endl;
-cout << tri.matrixT() << endl;
-tri.compute(2*A); // re-use tri to compute eigenvalues of 2A
-cout << "The matrix T in the tridiagonal decomposition of 2A is: " << endl;
-cout << tri.matrixT() << endl;
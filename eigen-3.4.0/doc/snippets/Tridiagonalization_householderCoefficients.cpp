@@ -1,6 +0,0 @@
-Matrix4d X = Matrix4d::Random(4,4);
-Matrix4d A = X + X.transpose();
-cout << "Here is a random symmetric 4x4 matrix:" << endl << A << endl;
-Tridiagonalization<Matrix4d> triOfA(A);
-Vector3d hc = triOfA.householderCoefficients();
-cout << "The vector of Householder coefficients is:" << endl << hc << endl;
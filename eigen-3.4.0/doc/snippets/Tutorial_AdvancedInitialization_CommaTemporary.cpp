@@ -1,4 +0,0 @@
-MatrixXf mat = MatrixXf::Random(2, 3);
-std::cout << mat << std::endl << std::endl;
-mat = (MatrixXf(2,2) << 0, 1, 1, 0).finished() * mat;
-std::cout << mat << std::endl;
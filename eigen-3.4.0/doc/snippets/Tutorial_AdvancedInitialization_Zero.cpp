@@ -1,13 +0,0 @@
-std::cout << "A fixed-size array:\n";
-Array33f a1 = Array33f::Zero();
-std::cout << a1 << "\n\n";
-
-
-std::cout << "A one-dimensional dynamic-size array:\n";
-ArrayXf a2 = ArrayXf::Zero(3);
-std::cout << a2 << "\n\n";
-
-
-std::cout << "A two-dimensional dynamic-size array:\n";
-ArrayXXf a3 = ArrayXXf::Zero(3, 4);
-std::cout << a3 << "\n";
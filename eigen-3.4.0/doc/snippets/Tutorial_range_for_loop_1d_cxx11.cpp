@@ -1,4 +0,0 @@
-VectorXi v = VectorXi::Random(4);
-cout << "Here is the vector v:\n";
-for(auto x : v) cout << x << " ";
-cout << "\n";
@@ -1,16 +0,0 @@
-#include "../Eigen/Core"
-
-#ifdef EIGEN_SHOULD_FAIL_TO_BUILD
-#define CV_QUALIFIER const
-#else
-#define CV_QUALIFIER
-#endif
-
-using namespace Eigen;
-
-void foo(CV_QUALIFIER Matrix3d &m){
-    // row/column constructor
-    Block<Matrix3d,3,1> b(m,0);
-}
-
-int main() {}
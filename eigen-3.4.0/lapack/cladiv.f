@@ -1,97 +0,0 @@
-*> \brief \b CLADIV
-*
-*  =========== DOCUMENTATION ===========
-*
-* Online html documentation available at 
-*            http://www.netlib.org/lapack/explore-html/ 
-*
-*> \htmlonly
-*> Download CLADIV + dependencies 
-*> <a href="http://www.netlib.org/cgi-bin/netlibfiles.tgz?format=tgz&filename=/lapack/lapack_routine/cladiv.f"> 
-*> [TGZ]</a> 
-*> <a href="http://www.netlib.org/cgi-bin/netlibfiles.zip?format=zip&filename=/lapack/lapack_routine/cladiv.f"> 
-*> [ZIP]</a> 
-*> <a href="http://www.netlib.org/cgi-bin/netlibfiles.txt?format=txt&filename=/lapack/lapack_routine/cladiv.f"> 
-*> [TXT]</a>
-*> \endhtmlonly 
-*
-*  Definition:
-*  ===========
-*
-*       COMPLEX FUNCTION CLADIV( X, Y )
-* 
-*       .. Scalar Arguments ..
-*       COMPLEX            X, Y
-*       ..
-*  
-*
-*> \par Purpose:
-*  =============
-*>
-*> \verbatim
-*>
-*> CLADIV := X / Y, where X and Y are complex.  The computation of X / Y
-*> will not overflow on an intermediary step unless the results
-*> overflows.
-*> \endverbatim
-*
-*  Arguments:
-*  ==========
-*
-*> \param[in] X
-*> \verbatim
-*>          X is COMPLEX
-*> \endverbatim
-*>
-*> \param[in] Y
-*> \verbatim
-*>          Y is COMPLEX
-*>          The complex scalars X and Y.
-*> \endverbatim
-*
-*  Authors:
-*  ========
-*
-*> \author Univ. of Tennessee 
-*> \author Univ. of California Berkeley 
-*> \author Univ. of Colorado Denver 
-*> \author NAG Ltd. 
-*
-*> \date November 2011
-*
-*> \ingroup complexOTHERauxiliary
-*
-*  =====================================================================
-      COMPLEX FUNCTION CLADIV( X, Y )
-*
-*  -- LAPACK auxiliary routine (version 3.4.0) --
-*  -- LAPACK is a software package provided by Univ. of Tennessee,    --
-*  -- Univ. of California Berkeley, Univ. of Colorado Denver and NAG Ltd..--
-*     November 2011
-*
-*     .. Scalar Arguments ..
-      COMPLEX            X, Y
-*     ..
-*
-*  =====================================================================
-*
-*     .. Local Scalars ..
-      REAL               ZI, ZR
-*     ..
-*     .. External Subroutines ..
-      EXTERNAL           SLADIV
-*     ..
-*     .. Intrinsic Functions ..
-      INTRINSIC          AIMAG, CMPLX, REAL
-*     ..
-*     .. Executable Statements ..
-*
-      CALL SLADIV( REAL( X ), AIMAG( X ), REAL( Y ), AIMAG( Y ), ZR,
-     $             ZI )
-      CLADIV = CMPLX( ZR, ZI )
-*
-      RETURN
-*
-*     End of CLADIV
-*
-      END
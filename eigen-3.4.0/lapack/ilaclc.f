@@ -1,118 +0,0 @@
-*> \brief \b ILACLC
-*
-*  =========== DOCUMENTATION ===========
-*
-* Online html documentation available at 
-*            http://www.netlib.org/lapack/explore-html/ 
-*
-*> \htmlonly
-*> Download ILACLC + dependencies 
-*> <a href="http://www.netlib.org/cgi-bin/netlibfiles.tgz?format=tgz&filename=/lapack/lapack_routine/ilaclc.f"> 
-*> [TGZ]</a> 
-*> <a href="http://www.netlib.org/cgi-bin/netlibfiles.zip?format=zip&filename=/lapack/lapack_routine/ilaclc.f"> 
-*> [ZIP]</a> 
-*> <a href="http://www.netlib.org/cgi-bin/netlibfiles.txt?format=txt&filename=/lapack/lapack_routine/ilaclc.f"> 
-*> [TXT]</a>
-*> \endhtmlonly 
-*
-*  Definition:
-*  ===========
-*
-*       INTEGER FUNCTION ILACLC( M, N, A, LDA )
-* 
-*       .. Scalar Arguments ..
-*       INTEGER            M, N, LDA
-*       ..
-*       .. Array Arguments ..
-*       COMPLEX            A( LDA, * )
-*       ..
-*  
-*
-*> \par Purpose:
-*  =============
-*>
-*> \verbatim
-*>
-*> ILACLC scans A for its last non-zero column.
-*> \endverbatim
-*
-*  Arguments:
-*  ==========
-*
-*> \param[in] M
-*> \verbatim
-*>          M is INTEGER
-*>          The number of rows of the matrix A.
-*> \endverbatim
-*>
-*> \param[in] N
-*> \verbatim
-*>          N is INTEGER
-*>          The number of columns of the matrix A.
-*> \endverbatim
-*>
-*> \param[in] A
-*> \verbatim
-*>          A is COMPLEX array, dimension (LDA,N)
-*>          The m by n matrix A.
-*> \endverbatim
-*>
-*> \param[in] LDA
-*> \verbatim
-*>          LDA is INTEGER
-*>          The leading dimension of the array A. LDA >= max(1,M).
-*> \endverbatim
-*
-*  Authors:
-*  ========
-*
-*> \author Univ. of Tennessee 
-*> \author Univ. of California Berkeley 
-*> \author Univ. of Colorado Denver 
-*> \author NAG Ltd. 
-*
-*> \date November 2011
-*
-*> \ingroup complexOTHERauxiliary
-*
-*  =====================================================================
-      INTEGER FUNCTION ILACLC( M, N, A, LDA )
-*
-*  -- LAPACK auxiliary routine (version 3.4.0) --
-*  -- LAPACK is a software package provided by Univ. of Tennessee,    --
-*  -- Univ. of California Berkeley, Univ. of Colorado Denver and NAG Ltd..--
-*     November 2011
-*
-*     .. Scalar Arguments ..
-      INTEGER            M, N, LDA
-*     ..
-*     .. Array Arguments ..
-      COMPLEX            A( LDA, * )
-*     ..
-*
-*  =====================================================================
-*
-*     .. Parameters ..
-      COMPLEX          ZERO
-      PARAMETER ( ZERO = (0.0E+0, 0.0E+0) )
-*     ..
-*     .. Local Scalars ..
-      INTEGER I
-*     ..
-*     .. Executable Statements ..
-*
-*     Quick test for the common case where one corner is non-zero.
-      IF( N.EQ.0 ) THEN
-         ILACLC = N
-      ELSE IF( A(1, N).NE.ZERO .OR. A(M, N).NE.ZERO ) THEN
-         ILACLC = N
-      ELSE
-*     Now scan each column from the end, returning with the first non-zero.
-         DO ILACLC = N, 1, -1
-            DO I = 1, M
-               IF( A(I, ILACLC).NE.ZERO ) RETURN
-            END DO
-         END DO
-      END IF
-      RETURN
-      END
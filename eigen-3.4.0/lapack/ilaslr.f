@@ -1,121 +0,0 @@
-*> \brief \b ILASLR
-*
-*  =========== DOCUMENTATION ===========
-*
-* Online html documentation available at 
-*            http://www.netlib.org/lapack/explore-html/ 
-*
-*> \htmlonly
-*> Download ILASLR + dependencies 
-*> <a href="http://www.netlib.org/cgi-bin/netlibfiles.tgz?format=tgz&filename=/lapack/lapack_routine/ilaslr.f"> 
-*> [TGZ]</a> 
-*> <a href="http://www.netlib.org/cgi-bin/netlibfiles.zip?format=zip&filename=/lapack/lapack_routine/ilaslr.f"> 
-*> [ZIP]</a> 
-*> <a href="http://www.netlib.org/cgi-bin/netlibfiles.txt?format=txt&filename=/lapack/lapack_routine/ilaslr.f"> 
-*> [TXT]</a>
-*> \endhtmlonly 
-*
-*  Definition:
-*  ===========
-*
-*       INTEGER FUNCTION ILASLR( M, N, A, LDA )
-* 
-*       .. Scalar Arguments ..
-*       INTEGER            M, N, LDA
-*       ..
-*       .. Array Arguments ..
-*       REAL               A( LDA, * )
-*       ..
-*  
-*
-*> \par Purpose:
-*  =============
-*>
-*> \verbatim
-*>
-*> ILASLR scans A for its last non-zero row.
-*> \endverbatim
-*
-*  Arguments:
-*  ==========
-*
-*> \param[in] M
-*> \verbatim
-*>          M is INTEGER
-*>          The number of rows of the matrix A.
-*> \endverbatim
-*>
-*> \param[in] N
-*> \verbatim
-*>          N is INTEGER
-*>          The number of columns of the matrix A.
-*> \endverbatim
-*>
-*> \param[in] A
-*> \verbatim
-*>          A is REAL array, dimension (LDA,N)
-*>          The m by n matrix A.
-*> \endverbatim
-*>
-*> \param[in] LDA
-*> \verbatim
-*>          LDA is INTEGER
-*>          The leading dimension of the array A. LDA >= max(1,M).
-*> \endverbatim
-*
-*  Authors:
-*  ========
-*
-*> \author Univ. of Tennessee 
-*> \author Univ. of California Berkeley 
-*> \author Univ. of Colorado Denver 
-*> \author NAG Ltd. 
-*
-*> \date April 2012
-*
-*> \ingroup realOTHERauxiliary
-*
-*  =====================================================================
-      INTEGER FUNCTION ILASLR( M, N, A, LDA )
-*
-*  -- LAPACK auxiliary routine (version 3.4.1) --
-*  -- LAPACK is a software package provided by Univ. of Tennessee,    --
-*  -- Univ. of California Berkeley, Univ. of Colorado Denver and NAG Ltd..--
-*     April 2012
-*
-*     .. Scalar Arguments ..
-      INTEGER            M, N, LDA
-*     ..
-*     .. Array Arguments ..
-      REAL               A( LDA, * )
-*     ..
-*
-*  =====================================================================
-*
-*     .. Parameters ..
-      REAL             ZERO
-      PARAMETER ( ZERO = 0.0E+0 )
-*     ..
-*     .. Local Scalars ..
-      INTEGER I, J
-*     ..
-*     .. Executable Statements ..
-*
-*     Quick test for the common case where one corner is non-zero.
-      IF( M.EQ.0 ) THEN
-         ILASLR = M
-      ELSEIF( A(M, 1).NE.ZERO .OR. A(M, N).NE.ZERO ) THEN
-         ILASLR = M
-      ELSE
-*     Scan up each column tracking the last zero row seen.
-         ILASLR = 0
-         DO J = 1, N
-            I=M
-            DO WHILE((A(MAX(I,1),J).EQ.ZERO).AND.(I.GE.1))
-               I=I-1
-            ENDDO
-            ILASLR = MAX( ILASLR, I )
-         END DO
-      END IF
-      RETURN
-      END
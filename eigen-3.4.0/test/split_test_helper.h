@@ -1,5994 +0,0 @@
-#if defined(EIGEN_TEST_PART_1) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_1(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_1(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_2) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_2(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_2(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_3) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_3(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_3(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_4) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_4(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_4(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_5) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_5(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_5(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_6) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_6(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_6(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_7) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_7(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_7(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_8) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_8(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_8(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_9) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_9(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_9(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_10) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_10(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_10(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_11) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_11(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_11(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_12) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_12(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_12(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_13) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_13(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_13(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_14) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_14(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_14(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_15) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_15(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_15(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_16) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_16(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_16(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_17) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_17(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_17(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_18) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_18(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_18(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_19) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_19(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_19(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_20) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_20(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_20(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_21) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_21(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_21(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_22) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_22(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_22(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_23) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_23(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_23(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_24) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_24(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_24(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_25) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_25(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_25(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_26) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_26(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_26(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_27) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_27(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_27(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_28) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_28(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_28(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_29) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_29(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_29(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_30) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_30(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_30(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_31) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_31(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_31(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_32) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_32(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_32(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_33) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_33(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_33(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_34) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_34(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_34(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_35) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_35(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_35(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_36) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_36(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_36(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_37) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_37(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_37(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_38) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_38(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_38(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_39) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_39(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_39(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_40) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_40(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_40(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_41) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_41(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_41(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_42) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_42(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_42(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_43) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_43(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_43(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_44) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_44(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_44(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_45) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_45(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_45(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_46) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_46(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_46(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_47) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_47(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_47(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_48) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_48(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_48(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_49) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_49(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_49(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_50) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_50(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_50(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_51) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_51(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_51(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_52) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_52(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_52(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_53) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_53(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_53(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_54) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_54(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_54(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_55) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_55(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_55(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_56) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_56(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_56(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_57) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_57(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_57(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_58) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_58(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_58(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_59) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_59(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_59(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_60) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_60(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_60(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_61) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_61(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_61(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_62) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_62(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_62(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_63) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_63(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_63(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_64) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_64(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_64(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_65) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_65(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_65(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_66) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_66(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_66(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_67) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_67(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_67(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_68) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_68(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_68(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_69) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_69(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_69(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_70) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_70(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_70(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_71) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_71(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_71(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_72) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_72(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_72(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_73) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_73(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_73(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_74) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_74(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_74(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_75) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_75(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_75(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_76) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_76(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_76(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_77) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_77(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_77(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_78) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_78(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_78(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_79) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_79(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_79(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_80) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_80(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_80(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_81) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_81(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_81(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_82) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_82(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_82(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_83) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_83(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_83(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_84) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_84(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_84(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_85) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_85(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_85(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_86) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_86(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_86(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_87) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_87(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_87(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_88) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_88(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_88(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_89) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_89(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_89(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_90) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_90(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_90(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_91) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_91(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_91(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_92) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_92(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_92(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_93) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_93(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_93(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_94) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_94(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_94(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_95) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_95(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_95(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_96) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_96(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_96(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_97) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_97(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_97(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_98) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_98(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_98(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_99) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_99(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_99(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_100) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_100(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_100(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_101) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_101(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_101(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_102) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_102(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_102(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_103) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_103(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_103(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_104) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_104(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_104(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_105) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_105(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_105(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_106) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_106(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_106(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_107) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_107(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_107(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_108) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_108(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_108(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_109) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_109(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_109(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_110) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_110(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_110(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_111) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_111(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_111(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_112) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_112(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_112(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_113) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_113(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_113(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_114) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_114(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_114(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_115) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_115(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_115(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_116) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_116(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_116(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_117) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_117(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_117(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_118) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_118(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_118(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_119) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_119(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_119(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_120) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_120(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_120(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_121) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_121(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_121(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_122) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_122(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_122(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_123) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_123(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_123(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_124) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_124(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_124(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_125) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_125(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_125(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_126) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_126(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_126(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_127) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_127(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_127(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_128) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_128(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_128(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_129) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_129(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_129(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_130) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_130(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_130(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_131) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_131(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_131(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_132) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_132(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_132(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_133) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_133(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_133(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_134) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_134(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_134(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_135) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_135(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_135(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_136) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_136(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_136(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_137) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_137(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_137(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_138) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_138(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_138(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_139) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_139(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_139(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_140) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_140(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_140(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_141) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_141(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_141(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_142) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_142(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_142(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_143) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_143(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_143(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_144) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_144(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_144(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_145) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_145(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_145(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_146) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_146(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_146(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_147) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_147(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_147(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_148) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_148(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_148(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_149) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_149(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_149(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_150) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_150(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_150(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_151) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_151(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_151(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_152) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_152(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_152(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_153) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_153(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_153(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_154) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_154(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_154(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_155) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_155(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_155(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_156) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_156(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_156(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_157) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_157(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_157(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_158) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_158(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_158(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_159) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_159(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_159(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_160) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_160(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_160(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_161) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_161(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_161(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_162) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_162(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_162(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_163) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_163(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_163(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_164) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_164(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_164(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_165) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_165(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_165(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_166) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_166(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_166(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_167) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_167(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_167(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_168) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_168(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_168(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_169) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_169(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_169(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_170) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_170(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_170(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_171) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_171(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_171(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_172) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_172(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_172(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_173) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_173(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_173(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_174) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_174(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_174(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_175) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_175(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_175(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_176) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_176(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_176(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_177) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_177(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_177(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_178) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_178(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_178(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_179) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_179(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_179(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_180) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_180(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_180(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_181) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_181(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_181(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_182) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_182(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_182(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_183) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_183(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_183(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_184) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_184(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_184(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_185) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_185(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_185(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_186) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_186(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_186(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_187) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_187(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_187(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_188) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_188(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_188(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_189) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_189(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_189(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_190) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_190(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_190(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_191) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_191(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_191(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_192) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_192(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_192(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_193) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_193(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_193(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_194) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_194(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_194(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_195) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_195(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_195(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_196) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_196(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_196(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_197) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_197(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_197(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_198) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_198(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_198(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_199) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_199(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_199(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_200) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_200(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_200(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_201) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_201(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_201(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_202) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_202(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_202(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_203) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_203(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_203(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_204) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_204(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_204(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_205) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_205(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_205(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_206) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_206(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_206(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_207) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_207(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_207(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_208) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_208(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_208(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_209) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_209(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_209(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_210) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_210(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_210(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_211) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_211(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_211(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_212) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_212(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_212(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_213) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_213(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_213(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_214) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_214(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_214(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_215) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_215(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_215(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_216) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_216(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_216(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_217) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_217(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_217(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_218) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_218(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_218(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_219) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_219(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_219(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_220) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_220(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_220(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_221) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_221(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_221(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_222) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_222(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_222(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_223) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_223(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_223(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_224) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_224(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_224(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_225) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_225(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_225(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_226) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_226(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_226(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_227) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_227(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_227(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_228) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_228(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_228(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_229) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_229(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_229(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_230) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_230(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_230(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_231) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_231(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_231(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_232) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_232(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_232(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_233) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_233(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_233(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_234) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_234(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_234(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_235) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_235(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_235(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_236) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_236(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_236(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_237) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_237(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_237(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_238) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_238(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_238(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_239) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_239(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_239(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_240) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_240(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_240(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_241) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_241(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_241(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_242) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_242(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_242(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_243) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_243(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_243(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_244) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_244(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_244(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_245) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_245(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_245(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_246) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_246(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_246(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_247) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_247(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_247(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_248) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_248(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_248(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_249) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_249(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_249(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_250) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_250(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_250(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_251) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_251(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_251(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_252) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_252(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_252(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_253) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_253(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_253(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_254) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_254(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_254(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_255) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_255(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_255(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_256) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_256(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_256(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_257) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_257(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_257(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_258) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_258(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_258(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_259) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_259(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_259(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_260) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_260(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_260(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_261) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_261(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_261(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_262) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_262(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_262(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_263) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_263(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_263(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_264) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_264(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_264(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_265) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_265(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_265(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_266) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_266(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_266(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_267) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_267(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_267(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_268) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_268(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_268(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_269) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_269(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_269(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_270) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_270(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_270(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_271) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_271(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_271(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_272) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_272(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_272(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_273) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_273(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_273(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_274) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_274(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_274(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_275) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_275(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_275(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_276) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_276(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_276(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_277) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_277(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_277(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_278) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_278(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_278(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_279) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_279(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_279(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_280) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_280(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_280(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_281) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_281(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_281(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_282) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_282(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_282(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_283) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_283(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_283(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_284) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_284(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_284(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_285) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_285(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_285(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_286) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_286(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_286(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_287) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_287(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_287(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_288) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_288(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_288(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_289) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_289(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_289(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_290) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_290(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_290(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_291) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_291(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_291(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_292) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_292(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_292(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_293) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_293(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_293(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_294) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_294(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_294(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_295) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_295(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_295(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_296) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_296(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_296(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_297) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_297(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_297(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_298) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_298(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_298(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_299) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_299(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_299(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_300) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_300(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_300(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_301) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_301(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_301(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_302) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_302(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_302(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_303) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_303(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_303(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_304) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_304(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_304(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_305) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_305(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_305(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_306) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_306(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_306(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_307) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_307(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_307(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_308) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_308(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_308(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_309) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_309(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_309(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_310) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_310(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_310(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_311) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_311(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_311(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_312) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_312(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_312(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_313) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_313(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_313(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_314) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_314(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_314(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_315) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_315(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_315(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_316) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_316(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_316(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_317) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_317(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_317(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_318) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_318(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_318(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_319) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_319(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_319(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_320) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_320(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_320(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_321) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_321(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_321(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_322) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_322(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_322(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_323) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_323(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_323(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_324) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_324(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_324(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_325) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_325(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_325(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_326) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_326(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_326(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_327) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_327(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_327(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_328) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_328(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_328(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_329) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_329(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_329(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_330) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_330(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_330(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_331) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_331(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_331(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_332) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_332(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_332(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_333) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_333(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_333(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_334) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_334(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_334(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_335) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_335(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_335(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_336) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_336(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_336(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_337) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_337(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_337(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_338) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_338(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_338(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_339) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_339(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_339(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_340) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_340(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_340(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_341) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_341(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_341(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_342) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_342(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_342(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_343) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_343(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_343(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_344) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_344(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_344(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_345) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_345(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_345(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_346) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_346(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_346(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_347) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_347(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_347(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_348) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_348(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_348(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_349) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_349(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_349(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_350) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_350(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_350(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_351) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_351(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_351(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_352) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_352(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_352(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_353) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_353(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_353(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_354) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_354(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_354(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_355) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_355(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_355(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_356) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_356(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_356(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_357) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_357(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_357(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_358) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_358(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_358(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_359) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_359(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_359(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_360) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_360(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_360(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_361) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_361(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_361(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_362) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_362(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_362(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_363) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_363(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_363(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_364) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_364(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_364(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_365) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_365(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_365(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_366) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_366(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_366(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_367) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_367(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_367(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_368) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_368(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_368(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_369) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_369(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_369(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_370) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_370(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_370(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_371) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_371(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_371(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_372) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_372(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_372(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_373) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_373(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_373(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_374) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_374(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_374(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_375) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_375(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_375(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_376) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_376(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_376(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_377) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_377(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_377(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_378) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_378(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_378(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_379) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_379(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_379(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_380) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_380(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_380(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_381) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_381(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_381(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_382) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_382(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_382(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_383) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_383(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_383(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_384) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_384(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_384(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_385) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_385(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_385(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_386) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_386(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_386(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_387) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_387(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_387(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_388) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_388(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_388(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_389) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_389(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_389(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_390) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_390(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_390(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_391) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_391(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_391(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_392) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_392(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_392(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_393) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_393(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_393(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_394) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_394(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_394(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_395) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_395(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_395(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_396) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_396(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_396(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_397) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_397(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_397(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_398) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_398(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_398(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_399) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_399(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_399(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_400) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_400(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_400(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_401) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_401(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_401(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_402) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_402(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_402(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_403) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_403(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_403(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_404) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_404(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_404(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_405) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_405(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_405(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_406) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_406(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_406(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_407) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_407(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_407(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_408) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_408(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_408(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_409) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_409(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_409(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_410) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_410(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_410(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_411) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_411(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_411(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_412) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_412(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_412(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_413) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_413(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_413(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_414) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_414(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_414(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_415) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_415(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_415(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_416) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_416(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_416(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_417) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_417(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_417(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_418) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_418(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_418(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_419) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_419(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_419(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_420) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_420(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_420(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_421) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_421(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_421(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_422) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_422(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_422(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_423) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_423(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_423(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_424) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_424(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_424(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_425) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_425(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_425(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_426) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_426(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_426(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_427) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_427(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_427(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_428) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_428(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_428(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_429) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_429(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_429(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_430) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_430(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_430(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_431) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_431(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_431(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_432) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_432(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_432(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_433) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_433(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_433(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_434) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_434(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_434(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_435) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_435(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_435(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_436) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_436(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_436(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_437) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_437(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_437(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_438) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_438(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_438(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_439) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_439(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_439(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_440) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_440(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_440(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_441) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_441(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_441(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_442) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_442(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_442(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_443) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_443(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_443(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_444) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_444(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_444(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_445) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_445(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_445(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_446) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_446(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_446(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_447) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_447(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_447(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_448) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_448(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_448(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_449) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_449(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_449(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_450) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_450(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_450(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_451) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_451(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_451(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_452) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_452(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_452(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_453) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_453(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_453(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_454) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_454(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_454(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_455) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_455(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_455(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_456) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_456(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_456(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_457) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_457(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_457(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_458) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_458(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_458(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_459) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_459(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_459(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_460) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_460(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_460(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_461) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_461(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_461(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_462) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_462(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_462(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_463) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_463(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_463(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_464) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_464(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_464(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_465) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_465(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_465(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_466) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_466(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_466(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_467) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_467(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_467(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_468) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_468(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_468(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_469) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_469(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_469(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_470) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_470(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_470(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_471) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_471(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_471(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_472) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_472(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_472(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_473) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_473(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_473(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_474) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_474(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_474(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_475) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_475(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_475(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_476) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_476(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_476(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_477) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_477(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_477(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_478) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_478(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_478(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_479) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_479(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_479(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_480) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_480(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_480(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_481) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_481(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_481(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_482) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_482(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_482(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_483) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_483(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_483(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_484) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_484(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_484(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_485) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_485(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_485(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_486) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_486(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_486(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_487) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_487(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_487(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_488) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_488(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_488(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_489) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_489(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_489(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_490) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_490(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_490(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_491) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_491(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_491(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_492) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_492(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_492(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_493) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_493(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_493(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_494) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_494(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_494(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_495) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_495(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_495(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_496) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_496(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_496(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_497) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_497(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_497(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_498) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_498(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_498(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_499) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_499(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_499(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_500) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_500(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_500(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_501) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_501(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_501(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_502) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_502(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_502(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_503) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_503(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_503(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_504) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_504(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_504(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_505) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_505(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_505(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_506) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_506(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_506(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_507) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_507(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_507(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_508) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_508(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_508(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_509) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_509(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_509(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_510) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_510(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_510(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_511) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_511(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_511(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_512) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_512(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_512(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_513) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_513(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_513(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_514) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_514(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_514(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_515) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_515(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_515(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_516) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_516(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_516(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_517) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_517(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_517(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_518) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_518(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_518(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_519) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_519(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_519(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_520) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_520(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_520(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_521) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_521(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_521(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_522) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_522(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_522(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_523) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_523(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_523(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_524) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_524(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_524(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_525) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_525(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_525(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_526) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_526(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_526(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_527) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_527(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_527(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_528) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_528(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_528(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_529) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_529(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_529(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_530) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_530(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_530(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_531) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_531(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_531(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_532) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_532(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_532(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_533) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_533(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_533(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_534) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_534(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_534(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_535) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_535(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_535(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_536) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_536(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_536(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_537) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_537(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_537(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_538) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_538(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_538(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_539) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_539(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_539(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_540) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_540(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_540(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_541) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_541(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_541(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_542) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_542(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_542(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_543) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_543(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_543(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_544) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_544(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_544(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_545) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_545(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_545(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_546) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_546(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_546(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_547) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_547(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_547(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_548) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_548(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_548(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_549) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_549(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_549(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_550) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_550(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_550(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_551) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_551(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_551(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_552) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_552(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_552(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_553) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_553(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_553(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_554) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_554(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_554(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_555) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_555(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_555(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_556) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_556(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_556(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_557) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_557(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_557(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_558) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_558(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_558(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_559) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_559(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_559(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_560) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_560(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_560(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_561) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_561(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_561(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_562) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_562(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_562(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_563) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_563(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_563(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_564) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_564(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_564(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_565) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_565(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_565(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_566) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_566(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_566(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_567) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_567(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_567(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_568) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_568(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_568(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_569) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_569(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_569(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_570) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_570(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_570(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_571) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_571(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_571(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_572) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_572(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_572(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_573) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_573(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_573(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_574) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_574(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_574(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_575) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_575(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_575(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_576) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_576(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_576(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_577) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_577(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_577(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_578) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_578(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_578(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_579) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_579(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_579(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_580) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_580(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_580(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_581) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_581(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_581(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_582) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_582(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_582(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_583) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_583(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_583(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_584) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_584(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_584(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_585) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_585(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_585(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_586) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_586(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_586(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_587) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_587(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_587(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_588) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_588(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_588(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_589) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_589(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_589(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_590) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_590(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_590(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_591) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_591(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_591(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_592) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_592(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_592(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_593) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_593(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_593(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_594) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_594(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_594(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_595) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_595(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_595(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_596) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_596(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_596(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_597) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_597(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_597(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_598) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_598(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_598(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_599) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_599(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_599(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_600) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_600(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_600(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_601) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_601(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_601(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_602) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_602(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_602(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_603) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_603(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_603(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_604) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_604(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_604(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_605) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_605(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_605(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_606) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_606(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_606(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_607) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_607(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_607(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_608) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_608(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_608(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_609) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_609(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_609(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_610) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_610(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_610(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_611) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_611(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_611(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_612) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_612(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_612(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_613) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_613(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_613(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_614) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_614(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_614(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_615) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_615(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_615(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_616) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_616(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_616(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_617) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_617(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_617(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_618) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_618(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_618(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_619) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_619(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_619(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_620) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_620(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_620(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_621) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_621(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_621(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_622) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_622(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_622(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_623) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_623(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_623(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_624) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_624(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_624(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_625) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_625(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_625(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_626) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_626(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_626(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_627) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_627(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_627(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_628) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_628(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_628(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_629) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_629(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_629(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_630) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_630(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_630(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_631) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_631(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_631(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_632) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_632(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_632(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_633) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_633(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_633(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_634) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_634(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_634(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_635) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_635(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_635(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_636) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_636(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_636(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_637) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_637(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_637(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_638) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_638(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_638(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_639) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_639(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_639(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_640) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_640(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_640(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_641) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_641(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_641(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_642) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_642(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_642(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_643) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_643(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_643(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_644) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_644(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_644(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_645) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_645(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_645(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_646) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_646(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_646(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_647) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_647(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_647(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_648) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_648(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_648(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_649) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_649(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_649(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_650) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_650(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_650(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_651) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_651(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_651(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_652) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_652(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_652(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_653) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_653(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_653(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_654) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_654(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_654(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_655) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_655(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_655(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_656) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_656(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_656(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_657) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_657(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_657(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_658) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_658(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_658(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_659) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_659(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_659(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_660) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_660(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_660(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_661) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_661(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_661(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_662) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_662(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_662(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_663) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_663(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_663(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_664) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_664(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_664(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_665) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_665(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_665(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_666) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_666(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_666(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_667) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_667(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_667(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_668) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_668(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_668(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_669) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_669(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_669(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_670) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_670(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_670(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_671) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_671(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_671(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_672) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_672(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_672(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_673) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_673(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_673(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_674) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_674(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_674(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_675) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_675(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_675(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_676) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_676(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_676(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_677) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_677(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_677(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_678) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_678(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_678(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_679) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_679(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_679(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_680) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_680(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_680(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_681) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_681(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_681(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_682) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_682(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_682(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_683) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_683(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_683(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_684) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_684(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_684(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_685) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_685(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_685(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_686) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_686(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_686(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_687) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_687(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_687(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_688) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_688(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_688(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_689) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_689(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_689(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_690) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_690(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_690(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_691) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_691(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_691(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_692) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_692(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_692(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_693) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_693(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_693(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_694) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_694(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_694(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_695) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_695(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_695(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_696) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_696(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_696(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_697) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_697(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_697(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_698) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_698(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_698(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_699) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_699(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_699(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_700) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_700(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_700(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_701) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_701(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_701(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_702) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_702(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_702(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_703) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_703(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_703(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_704) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_704(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_704(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_705) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_705(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_705(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_706) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_706(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_706(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_707) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_707(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_707(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_708) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_708(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_708(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_709) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_709(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_709(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_710) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_710(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_710(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_711) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_711(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_711(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_712) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_712(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_712(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_713) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_713(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_713(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_714) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_714(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_714(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_715) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_715(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_715(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_716) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_716(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_716(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_717) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_717(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_717(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_718) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_718(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_718(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_719) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_719(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_719(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_720) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_720(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_720(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_721) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_721(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_721(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_722) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_722(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_722(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_723) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_723(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_723(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_724) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_724(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_724(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_725) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_725(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_725(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_726) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_726(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_726(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_727) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_727(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_727(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_728) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_728(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_728(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_729) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_729(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_729(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_730) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_730(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_730(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_731) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_731(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_731(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_732) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_732(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_732(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_733) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_733(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_733(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_734) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_734(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_734(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_735) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_735(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_735(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_736) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_736(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_736(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_737) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_737(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_737(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_738) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_738(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_738(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_739) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_739(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_739(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_740) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_740(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_740(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_741) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_741(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_741(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_742) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_742(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_742(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_743) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_743(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_743(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_744) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_744(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_744(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_745) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_745(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_745(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_746) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_746(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_746(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_747) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_747(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_747(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_748) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_748(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_748(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_749) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_749(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_749(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_750) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_750(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_750(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_751) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_751(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_751(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_752) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_752(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_752(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_753) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_753(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_753(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_754) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_754(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_754(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_755) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_755(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_755(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_756) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_756(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_756(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_757) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_757(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_757(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_758) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_758(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_758(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_759) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_759(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_759(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_760) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_760(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_760(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_761) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_761(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_761(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_762) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_762(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_762(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_763) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_763(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_763(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_764) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_764(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_764(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_765) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_765(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_765(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_766) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_766(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_766(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_767) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_767(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_767(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_768) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_768(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_768(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_769) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_769(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_769(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_770) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_770(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_770(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_771) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_771(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_771(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_772) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_772(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_772(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_773) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_773(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_773(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_774) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_774(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_774(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_775) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_775(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_775(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_776) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_776(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_776(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_777) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_777(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_777(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_778) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_778(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_778(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_779) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_779(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_779(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_780) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_780(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_780(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_781) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_781(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_781(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_782) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_782(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_782(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_783) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_783(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_783(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_784) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_784(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_784(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_785) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_785(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_785(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_786) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_786(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_786(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_787) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_787(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_787(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_788) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_788(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_788(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_789) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_789(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_789(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_790) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_790(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_790(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_791) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_791(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_791(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_792) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_792(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_792(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_793) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_793(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_793(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_794) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_794(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_794(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_795) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_795(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_795(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_796) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_796(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_796(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_797) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_797(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_797(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_798) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_798(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_798(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_799) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_799(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_799(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_800) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_800(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_800(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_801) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_801(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_801(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_802) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_802(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_802(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_803) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_803(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_803(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_804) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_804(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_804(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_805) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_805(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_805(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_806) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_806(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_806(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_807) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_807(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_807(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_808) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_808(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_808(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_809) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_809(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_809(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_810) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_810(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_810(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_811) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_811(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_811(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_812) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_812(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_812(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_813) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_813(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_813(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_814) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_814(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_814(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_815) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_815(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_815(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_816) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_816(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_816(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_817) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_817(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_817(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_818) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_818(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_818(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_819) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_819(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_819(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_820) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_820(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_820(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_821) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_821(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_821(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_822) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_822(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_822(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_823) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_823(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_823(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_824) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_824(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_824(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_825) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_825(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_825(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_826) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_826(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_826(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_827) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_827(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_827(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_828) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_828(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_828(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_829) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_829(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_829(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_830) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_830(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_830(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_831) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_831(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_831(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_832) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_832(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_832(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_833) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_833(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_833(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_834) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_834(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_834(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_835) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_835(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_835(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_836) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_836(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_836(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_837) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_837(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_837(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_838) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_838(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_838(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_839) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_839(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_839(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_840) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_840(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_840(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_841) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_841(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_841(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_842) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_842(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_842(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_843) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_843(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_843(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_844) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_844(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_844(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_845) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_845(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_845(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_846) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_846(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_846(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_847) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_847(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_847(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_848) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_848(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_848(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_849) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_849(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_849(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_850) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_850(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_850(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_851) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_851(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_851(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_852) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_852(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_852(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_853) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_853(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_853(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_854) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_854(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_854(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_855) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_855(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_855(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_856) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_856(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_856(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_857) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_857(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_857(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_858) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_858(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_858(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_859) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_859(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_859(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_860) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_860(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_860(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_861) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_861(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_861(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_862) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_862(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_862(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_863) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_863(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_863(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_864) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_864(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_864(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_865) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_865(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_865(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_866) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_866(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_866(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_867) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_867(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_867(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_868) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_868(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_868(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_869) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_869(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_869(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_870) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_870(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_870(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_871) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_871(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_871(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_872) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_872(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_872(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_873) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_873(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_873(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_874) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_874(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_874(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_875) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_875(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_875(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_876) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_876(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_876(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_877) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_877(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_877(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_878) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_878(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_878(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_879) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_879(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_879(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_880) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_880(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_880(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_881) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_881(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_881(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_882) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_882(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_882(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_883) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_883(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_883(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_884) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_884(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_884(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_885) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_885(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_885(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_886) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_886(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_886(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_887) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_887(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_887(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_888) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_888(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_888(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_889) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_889(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_889(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_890) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_890(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_890(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_891) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_891(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_891(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_892) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_892(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_892(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_893) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_893(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_893(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_894) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_894(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_894(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_895) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_895(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_895(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_896) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_896(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_896(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_897) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_897(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_897(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_898) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_898(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_898(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_899) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_899(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_899(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_900) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_900(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_900(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_901) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_901(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_901(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_902) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_902(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_902(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_903) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_903(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_903(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_904) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_904(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_904(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_905) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_905(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_905(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_906) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_906(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_906(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_907) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_907(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_907(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_908) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_908(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_908(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_909) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_909(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_909(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_910) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_910(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_910(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_911) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_911(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_911(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_912) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_912(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_912(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_913) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_913(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_913(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_914) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_914(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_914(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_915) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_915(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_915(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_916) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_916(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_916(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_917) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_917(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_917(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_918) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_918(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_918(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_919) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_919(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_919(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_920) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_920(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_920(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_921) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_921(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_921(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_922) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_922(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_922(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_923) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_923(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_923(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_924) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_924(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_924(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_925) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_925(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_925(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_926) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_926(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_926(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_927) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_927(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_927(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_928) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_928(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_928(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_929) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_929(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_929(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_930) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_930(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_930(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_931) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_931(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_931(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_932) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_932(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_932(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_933) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_933(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_933(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_934) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_934(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_934(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_935) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_935(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_935(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_936) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_936(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_936(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_937) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_937(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_937(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_938) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_938(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_938(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_939) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_939(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_939(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_940) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_940(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_940(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_941) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_941(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_941(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_942) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_942(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_942(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_943) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_943(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_943(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_944) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_944(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_944(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_945) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_945(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_945(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_946) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_946(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_946(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_947) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_947(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_947(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_948) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_948(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_948(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_949) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_949(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_949(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_950) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_950(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_950(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_951) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_951(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_951(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_952) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_952(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_952(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_953) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_953(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_953(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_954) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_954(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_954(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_955) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_955(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_955(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_956) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_956(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_956(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_957) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_957(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_957(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_958) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_958(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_958(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_959) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_959(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_959(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_960) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_960(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_960(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_961) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_961(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_961(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_962) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_962(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_962(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_963) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_963(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_963(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_964) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_964(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_964(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_965) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_965(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_965(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_966) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_966(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_966(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_967) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_967(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_967(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_968) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_968(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_968(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_969) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_969(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_969(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_970) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_970(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_970(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_971) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_971(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_971(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_972) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_972(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_972(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_973) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_973(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_973(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_974) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_974(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_974(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_975) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_975(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_975(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_976) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_976(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_976(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_977) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_977(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_977(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_978) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_978(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_978(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_979) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_979(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_979(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_980) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_980(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_980(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_981) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_981(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_981(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_982) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_982(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_982(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_983) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_983(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_983(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_984) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_984(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_984(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_985) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_985(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_985(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_986) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_986(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_986(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_987) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_987(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_987(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_988) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_988(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_988(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_989) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_989(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_989(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_990) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_990(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_990(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_991) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_991(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_991(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_992) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_992(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_992(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_993) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_993(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_993(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_994) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_994(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_994(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_995) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_995(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_995(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_996) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_996(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_996(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_997) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_997(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_997(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_998) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_998(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_998(FUNC)
-#endif
-
-#if defined(EIGEN_TEST_PART_999) || defined(EIGEN_TEST_PART_ALL)
-#define CALL_SUBTEST_999(FUNC) CALL_SUBTEST(FUNC)
-#else
-#define CALL_SUBTEST_999(FUNC)
-#endif
-
@@ -30,7 +30,6 @@
               ./cmake
               ./src
               ./sbvaConfig.cmake.in
-              ./eigen-3.4.0
             ];
           };
           nativeBuildInputs = [
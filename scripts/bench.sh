@@ -0,0 +1,59 @@
+#!/usr/bin/env bash
+# Compares the wall-clock time of one or more sbva binaries on a set of CNFs.
+#
+# Usage: bench.sh [-n reps] [-a "sbva args"] bin1 [bin2 ...] [-- file1.cnf ...]
+#
+# Each binary is run `reps` times per file and the best time is reported.
+# Files default to the instances in examples/. Useful arguments are e.g.
+# "-s 0" to measure loading and writing only, or "-v 1" to also see the
+# per-phase timings that sbva prints itself.
+set -euo pipefail
+
+reps=3
+args=""
+while getopts "n:a:" opt; do
+    case $opt in
+        n) reps=$OPTARG ;;
+        a) args=$OPTARG ;;
+        *) exit 1 ;;
+    esac
+done
+shift $((OPTIND - 1))
+
+bins=()
+while [[ $# -gt 0 && "$1" != "--" ]]; do
+    bins+=("$1")
+    shift
+done
+[[ $# -gt 0 ]] && shift
+files=("$@")
+if [[ ${#files[@]} -eq 0 ]]; then
+    files=("$(dirname "$0")"/../examples/*.cnf)
+fi
+if [[ ${#bins[@]} -eq 0 ]]; then
+    echo "Usage: $0 [-n reps] [-a \"sbva args\"] bin1 [bin2 ...] [-- file1.cnf ...]"
+    exit 1
+fi
+
+out=$(mktemp)
+trap 'rm -f "$out"' EXIT
+
+printf "%-50s" "file"
+for b in "${bins[@]}"; do printf " %12s" "$(basename "$(dirname "$b")")/$(basename "$b")"; done
+echo
+for f in "${files[@]}"; do
+    printf "%-50s" "$(basename "$f" | cut -c1-50)"
+    for b in "${bins[@]}"; do
+        best=""
+        for ((i = 0; i < reps; i++)); do
+            start=$(date +%s.%N)
+            # shellcheck disable=SC2086
+            "$b" $args "$f" "$out" > /dev/null
+            end=$(date +%s.%N)
+            best=$(awk -v s="$start" -v e="$end" -v b="$best" \
+                'BEGIN { t = e - s; if (b == "" || t < b) b = t; print b }')
+        done
+        printf " %12.3f" "$best"
+    done
+    echo
+done
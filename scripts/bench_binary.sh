@@ -0,0 +1,61 @@
+#!/usr/bin/env bash
+# Compares loading and writing DIMACS text against the binary CNF format.
+#
+# Usage: bench_binary.sh [-n reps] sbva [file1.cnf ...]
+#
+# Every file is first converted to binary, with and without clause hashes.
+# Then each version is loaded and written back in the same format with
+# "-s 0", so no SBVA work is done, and the best wall-clock time of `reps`
+# runs is reported with the file sizes. Files default to the instances in
+# examples/, use larger ones, e.g. from gen_cnf.py, for meaningful times.
+set -euo pipefail
+
+reps=5
+while getopts "n:" opt; do
+    case $opt in
+        n) reps=$OPTARG ;;
+        *) exit 1 ;;
+    esac
+done
+shift $((OPTIND - 1))
+
+if [[ $# -lt 1 ]]; then
+    echo "Usage: $0 [-n reps] sbva [file1.cnf ...]"
+    exit 1
+fi
+bin=$1
+shift
+files=("$@")
+if [[ ${#files[@]} -eq 0 ]]; then
+    files=("$(dirname "$0")"/../examples/*.cnf)
+fi
+
+tmp=$(mktemp -d)
+trap 'rm -rf "$tmp"' EXIT
+
+# Best time of loading $1 and writing it to $2
+best_time() {
+    local best=""
+    for ((i = 0; i < reps; i++)); do
+        start=$(date +%s.%N)
+        "$bin" -s 0 "$@" > /dev/null
+        end=$(date +%s.%N)
+        best=$(awk -v s="$start" -v e="$end" -v b="$best" \
+            'BEGIN { t = e - s; if (b == "" || t < b) b = t; print b }')
+    done
+    echo "$best"
+}
+
+printf "%-40s %10s %10s %10s %10s %10s %10s\n" "file" "text B" "text s" "bin B" "bin s" "hash B" "hash s"
+for f in "${files[@]}"; do
+    "$bin" -s 0 "$f" "$tmp/in.cnf" > /dev/null
+    "$bin" -s 0 "$f" "$tmp/in.bcnf" > /dev/null
+    "$bin" -s 0 --binhash "$f" "$tmp/inh.bcnf" > /dev/null
+    t_text=$(best_time "$tmp/in.cnf" "$tmp/out.cnf")
+    t_bin=$(best_time "$tmp/in.bcnf" "$tmp/out.bcnf")
+    t_hash=$(best_time --binhash "$tmp/inh.bcnf" "$tmp/outh.bcnf")
+    printf "%-40s %10d %10.3f %10d %10.3f %10d %10.3f\n" "$(basename "$f" | cut -c1-40)" \
+        "$(stat -c %s "$tmp/in.cnf")" "$t_text" \
+        "$(stat -c %s "$tmp/in.bcnf")" "$t_bin" \
+        "$(stat -c %s "$tmp/inh.bcnf")" "$t_hash"
+done
@@ -0,0 +1,54 @@
+#!/usr/bin/env bash
+# Compares text and binary DRAT proofs: their size, and the wall-clock time
+# of a run that writes them, against a run without a proof.
+#
+# Usage: bench_proof.sh [-n reps] sbva [file1.cnf ...]
+#
+# Each run is done `reps` times and the best time is reported. Files default
+# to the instances in examples/.
+set -euo pipefail
+
+reps=5
+while getopts "n:" opt; do
+    case $opt in
+        n) reps=$OPTARG ;;
+        *) exit 1 ;;
+    esac
+done
+shift $((OPTIND - 1))
+
+if [[ $# -lt 1 ]]; then
+    echo "Usage: $0 [-n reps] sbva [file1.cnf ...]"
+    exit 1
+fi
+bin=$1
+shift
+files=("$@")
+if [[ ${#files[@]} -eq 0 ]]; then
+    files=("$(dirname "$0")"/../examples/*.cnf)
+fi
+
+tmp=$(mktemp -d)
+trap 'rm -rf "$tmp"' EXIT
+
+best_time() {
+    local best=""
+    for ((i = 0; i < reps; i++)); do
+        start=$(date +%s.%N)
+        "$bin" "$@" > /dev/null
+        end=$(date +%s.%N)
+        best=$(awk -v s="$start" -v e="$end" -v b="$best" \
+            'BEGIN { t = e - s; if (b == "" || t < b) b = t; print b }')
+    done
+    echo "$best"
+}
+
+printf "%-40s %10s %10s %10s %10s %10s\n" "file" "none s" "text B" "text s" "bin B" "bin s"
+for f in "${files[@]}"; do
+    t_none=$(best_time "$f" "$tmp/out.cnf")
+    t_text=$(best_time -p "$tmp/proof.drat" "$f" "$tmp/out.cnf")
+    t_bin=$(best_time --binproof -p "$tmp/proof.bdrat" "$f" "$tmp/out.cnf")
+    printf "%-40s %10.3f %10d %10.3f %10d %10.3f\n" "$(basename "$f" | cut -c1-40)" "$t_none" \
+        "$(stat -c %s "$tmp/proof.drat")" "$t_text" \
+        "$(stat -c %s "$tmp/proof.bdrat")" "$t_bin"
+done
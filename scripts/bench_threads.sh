@@ -0,0 +1,55 @@
+#!/usr/bin/env bash
+# Measures how loading scales with the number of threads, on a large CNF
+# generated by gen_cnf.py.
+#
+# Usage: bench_threads.sh [-n reps] [-c clauses] [-t "1 2 4 8"] sbva [file.cnf]
+#
+# Runs sbva with "-s 0", so only reading, loading and writing are timed, and
+# reports the best wall-clock time of `reps` runs per thread count. Without a
+# file, one with `clauses` random clauses of length 2 to 8 is generated in a
+# temporary directory.
+set -euo pipefail
+
+reps=3
+clauses=20000000
+threads="1 2 4 8"
+while getopts "n:c:t:" opt; do
+    case $opt in
+        n) reps=$OPTARG ;;
+        c) clauses=$OPTARG ;;
+        t) threads=$OPTARG ;;
+        *) exit 1 ;;
+    esac
+done
+shift $((OPTIND - 1))
+
+if [[ $# -lt 1 ]]; then
+    echo "Usage: $0 [-n reps] [-c clauses] [-t \"1 2 4 8\"] sbva [file.cnf]"
+    exit 1
+fi
+bin=$1
+
+tmp=$(mktemp -d)
+trap 'rm -rf "$tmp"' EXIT
+if [[ $# -ge 2 ]]; then
+    f=$2
+else
+    f=$tmp/large.cnf
+    python3 "$(dirname "$0")"/gen_cnf.py -v 1000000 -c "$clauses" -k 2,8 > "$f"
+fi
+echo "c $(basename "$f"): $(du -h "$f" | cut -f1)"
+
+printf "%8s %12s %8s\n" "threads" "time" "speedup"
+base=""
+for t in $threads; do
+    best=""
+    for ((i = 0; i < reps; i++)); do
+        start=$(date +%s.%N)
+        "$bin" -s 0 -t "$t" "$f" "$tmp/out.cnf" > /dev/null
+        end=$(date +%s.%N)
+        best=$(awk -v s="$start" -v e="$end" -v b="$best" \
+            'BEGIN { t = e - s; if (b == "" || t < b) b = t; print b }')
+    done
+    [[ -z "$base" ]] && base=$best
+    printf "%8s %12.3f %8.2f\n" "$t" "$best" "$(awk -v b="$base" -v t="$best" 'BEGIN { print b / t }')"
+done
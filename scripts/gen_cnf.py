@@ -0,0 +1,40 @@
+#!/usr/bin/env python3
+# Writes a random CNF for benchmarking to stdout.
+#
+# Usage: gen_cnf.py [-v vars] [-c clauses] [-k min,max] [-a groups,size] [-s seed]
+#
+# Clause lengths are uniform in [min, max]. With -a, pairwise at-most-one
+# constraints over `groups` disjoint groups of `size` variables are added
+# first, these are what BVA finds to replace. Mixing both gives occurrence
+# lists with clauses of many lengths.
+import argparse
+import random
+import sys
+
+p = argparse.ArgumentParser()
+p.add_argument("-v", type=int, default=10000, help="number of variables")
+p.add_argument("-c", type=int, default=50000, help="number of random clauses")
+p.add_argument("-k", default="3,3", help="min,max clause length")
+p.add_argument("-a", default="0,0", help="at-most-one groups,size")
+p.add_argument("-s", type=int, default=1, help="random seed")
+args = p.parse_args()
+
+random.seed(args.s)
+kmin, kmax = map(int, args.k.split(","))
+groups, gsize = map(int, args.a.split(","))
+if groups * gsize > args.v:
+    sys.exit("error: at-most-one groups need more variables than -v")
+
+num_cls = groups * gsize * (gsize - 1) // 2 + args.c
+out = sys.stdout
+out.write("p cnf %d %d\n" % (args.v, num_cls))
+for g in range(groups):
+    base = g * gsize + 1
+    for i in range(gsize):
+        for j in range(i + 1, gsize):
+            out.write("%d %d 0\n" % (-(base + i), -(base + j)))
+for _ in range(args.c):
+    k = random.randint(kmin, kmax)
+    vs = random.sample(range(1, args.v + 1), k)
+    out.write(" ".join(str(v if random.random() < 0.5 else -v) for v in vs))
+    out.write(" 0\n")
@@ -0,0 +1,84 @@
+/******************************************
+Copyright (C) 2024 Mate Soos
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+***********************************************/
+
+#pragma once
+
+#include <cstdint>
+#include "sbva.h"
+
+namespace SBVAImpl {
+
+using SBVA::CnfFormat;
+using SBVA::ProofFormat;
+
+// Binary CNF format, version 1. All integers are LEB128 varints, 7 bits per
+// byte, least significant first, unless stated otherwise.
+//
+//   "SBVB"                 magic
+//   u8 version             bincnf_version
+//   u8 flags               bincnf_hashes: every clause is followed by its hash
+//   varint num_vars
+//   varint num_clauses
+//   num_clauses times:
+//     varint size
+//     size times: varint zigzag(lit - previous lit), previous starts at 0
+//     u32 hash, little endian, if bincnf_hashes
+//
+// Literals are kept in the order they are written, so any clause survives
+// a round trip. Sorted clauses, as SBVA stores them, have small positive
+// deltas, most literals take one byte. The hash is Clause::hash_val() of
+// the sorted literals; it is ignored on clauses that are not sorted.
+static const char bincnf_magic[4] = {'S', 'B', 'V', 'B'};
+static const uint8_t bincnf_version = 1;
+static const uint8_t bincnf_hashes = 1;
+
+inline uint64_t zigzag(int64_t v) {
+    return ((uint64_t)v << 1) ^ (uint64_t)(v >> 63);
+}
+
+inline int64_t unzigzag(uint64_t v) {
+    return (int64_t)(v >> 1) ^ -(int64_t)(v & 1);
+}
+
+// Binary DRAT maps a literal to 2*var, plus 1 if negated, and writes it as
+// a varint. Lines start with 'a' or 'd' and end with a 0 byte.
+inline uint64_t drat_lit(int64_t lit) {
+    return lit < 0 ? (uint64_t)(-lit) * 2 + 1 : (uint64_t)lit * 2;
+}
+
+inline int64_t drat_unlit(uint64_t v) {
+    return (v & 1) ? -(int64_t)(v >> 1) : (int64_t)(v >> 1);
+}
+
+// Writes v to p, which must have room for 10 bytes, and returns the number
+// of bytes written
+inline uint32_t put_varint(char* p, uint64_t v) {
+    uint32_t n = 0;
+    while (v >= 0x80) {
+        p[n++] = (char)(v | 0x80);
+        v >>= 7;
+    }
+    p[n++] = (char)v;
+    return n;
+}
+
+}
@@ -0,0 +1,106 @@
+/******************************************
+Copyright (C) 2024 Mate Soos
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+***********************************************/
+
+
+#pragma once
+
+#include <cstdint>
+
+namespace SBVAImpl {
+
+// Clause difference kernels. Each writes the literals of a that are not in b
+// to out, in the order of a, and stops once limit literals are written, so
+// out needs room for limit literals. Returns the number written.
+//
+// Clauses may repeat a literal, nothing removes that on load. The difference
+// is then that of multisets, as the merge gives: each copy in b cancels one
+// in a, the first ones. The fixed-size kernels count the copies of a literal
+// in b, and the ones just before it in a, to do the same.
+//
+// Clauses in the matching loop of run_sbva mostly have 2 to 8 literals and
+// differ early, so the merge of two sorted clauses mispredicts a lot. For two
+// clauses of the same small size, every pair of literals is compared
+// instead, which is branch-free up to the output.
+
+// Merge of two sorted clauses, any sizes
+inline uint32_t clause_diff_merge(const int* a, uint32_t na, const int* b, uint32_t nb,
+    int* out, uint32_t limit)
+{
+    uint32_t n = 0;
+    uint32_t i = 0;
+    uint32_t j = 0;
+    while (i < na && j < nb) {
+        if (a[i] == b[j]) {
+            i++;
+            j++;
+        } else if (a[i] < b[j]) {
+            out[n++] = a[i++];
+            if (n == limit) return n;
+        } else {
+            j++;
+        }
+    }
+    while (i < na && n < limit) out[n++] = a[i++];
+    return n;
+}
+
+// Two clauses of N literals. The compiler fully unrolls and vectorizes the
+// inner loop.
+template<uint32_t N>
+inline uint32_t clause_diff_fixed(const int* a, const int* b, int* out, uint32_t limit) {
+    uint32_t n = 0;
+    uint32_t before = 0;
+    for (uint32_t i = 0; i < N; i++) {
+        uint32_t in_b = 0;
+        for (uint32_t j = 0; j < N; j++) in_b += (a[i] == b[j]);
+        before = (before + 1) * (i > 0 && a[i] == a[i-1]);
+        out[n] = a[i];
+        n += before >= in_b;
+        if (n == limit) break;
+    }
+    return n;
+}
+
+// a and b must be sorted for the merge, which is used unless both have the
+// same size, up to 8
+inline uint32_t clause_diff(const int* a, uint32_t na, const int* b, uint32_t nb,
+    int* out, uint32_t limit)
+{
+    if (limit == 0) return 0;
+    if (na == nb) {
+        switch (na) {
+            case 0: return 0;
+            case 1: return clause_diff_fixed<1>(a, b, out, limit);
+            case 2: return clause_diff_fixed<2>(a, b, out, limit);
+            case 3: return clause_diff_fixed<3>(a, b, out, limit);
+            case 4: return clause_diff_fixed<4>(a, b, out, limit);
+            case 5: return clause_diff_fixed<5>(a, b, out, limit);
+            case 6: return clause_diff_fixed<6>(a, b, out, limit);
+            case 7: return clause_diff_fixed<7>(a, b, out, limit);
+            case 8: return clause_diff_fixed<8>(a, b, out, limit);
+            default: break;
+        }
+    }
+    return clause_diff_merge(a, na, b, nb, out, limit);
+}
+
+}
@@ -0,0 +1,341 @@
+/******************************************
+Copyright (C) 2024 Mate Soos
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+***********************************************/
+
+#include "compress.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+
+#ifdef USE_ZLIB
+#include <zlib.h>
+#endif
+#ifdef USE_LZMA
+#include <lzma.h>
+#endif
+#ifdef USE_ZSTD
+#include <zstd.h>
+#endif
+
+namespace SBVAImpl {
+
+Compression detect_compression(const unsigned char* p, size_t n) {
+    if (n >= 2 && p[0] == 0x1f && p[1] == 0x8b) return Compression::Gzip;
+    if (n >= 6 && memcmp(p, "\xfd" "7zXZ\0", 6) == 0) return Compression::Xz;
+    if (n >= 4 && memcmp(p, "\x28\xb5\x2f\xfd", 4) == 0) return Compression::Zstd;
+    return Compression::None;
+}
+
+const char* compression_name(Compression c) {
+    switch (c) {
+        case Compression::Gzip: return "gzip";
+        case Compression::Xz: return "xz";
+        case Compression::Zstd: return "zstd";
+        default: return "none";
+    }
+}
+
+static void write_error() {
+    fprintf(stderr, "Error: Could not write output\n");
+    exit(1);
+}
+
+#ifdef USE_ZLIB
+class GzipDecoder : public Decoder {
+public:
+    GzipDecoder() {
+        memset(&zs, 0, sizeof(zs));
+        // 15 + 32: any window size, gzip or zlib header
+        if (inflateInit2(&zs, 15 + 32) != Z_OK) {
+            fprintf(stderr, "Error: Could not initialize gzip decompression\n");
+            exit(1);
+        }
+    }
+    ~GzipDecoder() override { inflateEnd(&zs); }
+
+    bool decode(const char*& in, const char* in_end, char* out, size_t out_cap,
+        size_t& out_len, bool& done) override
+    {
+        zs.next_in = (Bytef*)in;
+        zs.avail_in = (uInt)std::min<size_t>(in_end - in, UINT32_MAX);
+        zs.next_out = (Bytef*)out;
+        zs.avail_out = (uInt)std::min<size_t>(out_cap, UINT32_MAX);
+        int ret = inflate(&zs, Z_NO_FLUSH);
+        in = (const char*)zs.next_in;
+        out_len = (char*)zs.next_out - out;
+        done = ret == Z_STREAM_END;
+        return ret == Z_OK || ret == Z_STREAM_END || ret == Z_BUF_ERROR;
+    }
+
+    void reset() override { inflateReset(&zs); }
+
+private:
+    z_stream zs;
+};
+
+class GzipEncoder : public Encoder {
+public:
+    explicit GzipEncoder(FILE* _fout) : fout(_fout) {
+        memset(&zs, 0, sizeof(zs));
+        // 15 + 16: gzip header
+        if (deflateInit2(&zs, Z_DEFAULT_COMPRESSION, Z_DEFLATED, 15 + 16, 8, Z_DEFAULT_STRATEGY) != Z_OK) {
+            fprintf(stderr, "Error: Could not initialize gzip compression\n");
+            exit(1);
+        }
+    }
+    ~GzipEncoder() override { deflateEnd(&zs); }
+
+    bool write(const char* data, size_t len) override { return run(data, len, Z_NO_FLUSH); }
+    bool finish() override { return run(nullptr, 0, Z_FINISH); }
+
+private:
+    bool run(const char* data, size_t len, int flush) {
+        zs.next_in = (Bytef*)data;
+        zs.avail_in = (uInt)len;
+        int ret;
+        do {
+            zs.next_out = (Bytef*)out;
+            zs.avail_out = sizeof(out);
+            ret = deflate(&zs, flush);
+            if (ret == Z_STREAM_ERROR) return false;
+            const size_t n = sizeof(out) - zs.avail_out;
+            if (fwrite(out, 1, n, fout) != n) return false;
+        } while (zs.avail_out == 0 || (flush == Z_FINISH && ret != Z_STREAM_END));
+        return true;
+    }
+
+    FILE* fout;
+    z_stream zs;
+    char out[1U << 16];
+};
+#endif
+
+#ifdef USE_LZMA
+class XzDecoder : public Decoder {
+public:
+    XzDecoder() { reset(); }
+    ~XzDecoder() override { lzma_end(&ls); }
+
+    bool decode(const char*& in, const char* in_end, char* out, size_t out_cap,
+        size_t& out_len, bool& done) override
+    {
+        ls.next_in = (const uint8_t*)in;
+        ls.avail_in = in_end - in;
+        ls.next_out = (uint8_t*)out;
+        ls.avail_out = out_cap;
+        lzma_ret ret = lzma_code(&ls, LZMA_RUN);
+        in = (const char*)ls.next_in;
+        out_len = (char*)ls.next_out - out;
+        done = ret == LZMA_STREAM_END;
+        return ret == LZMA_OK || ret == LZMA_STREAM_END || ret == LZMA_BUF_ERROR;
+    }
+
+    void reset() override {
+        lzma_end(&ls);
+        ls = LZMA_STREAM_INIT;
+        if (lzma_stream_decoder(&ls, UINT64_MAX, 0) != LZMA_OK) {
+            fprintf(stderr, "Error: Could not initialize xz decompression\n");
+            exit(1);
+        }
+    }
+
+private:
+    lzma_stream ls = LZMA_STREAM_INIT;
+};
+
+class XzEncoder : public Encoder {
+public:
+    explicit XzEncoder(FILE* _fout) : fout(_fout) {
+        if (lzma_easy_encoder(&ls, 6, LZMA_CHECK_CRC64) != LZMA_OK) {
+            fprintf(stderr, "Error: Could not initialize xz compression\n");
+            exit(1);
+        }
+    }
+    ~XzEncoder() override { lzma_end(&ls); }
+
+    bool write(const char* data, size_t len) override { return run(data, len, LZMA_RUN); }
+    bool finish() override { return run(nullptr, 0, LZMA_FINISH); }
+
+private:
+    bool run(const char* data, size_t len, lzma_action action) {
+        ls.next_in = (const uint8_t*)data;
+        ls.avail_in = len;
+        lzma_ret ret;
+        do {
+            ls.next_out = (uint8_t*)out;
+            ls.avail_out = sizeof(out);
+            ret = lzma_code(&ls, action);
+            if (ret != LZMA_OK && ret != LZMA_STREAM_END) return false;
+            const size_t n = sizeof(out) - ls.avail_out;
+            if (fwrite(out, 1, n, fout) != n) return false;
+        } while (ls.avail_out == 0 || (action == LZMA_FINISH && ret != LZMA_STREAM_END));
+        return true;
+    }
+
+    FILE* fout;
+    lzma_stream ls = LZMA_STREAM_INIT;
+    char out[1U << 16];
+};
+#endif
+
+#ifdef USE_ZSTD
+class ZstdDecoder : public Decoder {
+public:
+    ZstdDecoder() : ds(ZSTD_createDStream()) {
+        if (ds == nullptr) {
+            fprintf(stderr, "Error: Could not initialize zstd decompression\n");
+            exit(1);
+        }
+    }
+    ~ZstdDecoder() override { ZSTD_freeDStream(ds); }
+
+    bool decode(const char*& in, const char* in_end, char* out, size_t out_cap,
+        size_t& out_len, bool& done) override
+    {
+        ZSTD_inBuffer ib = {in, (size_t)(in_end - in), 0};
+        ZSTD_outBuffer ob = {out, out_cap, 0};
+        size_t ret = ZSTD_decompressStream(ds, &ob, &ib);
+        in += ib.pos;
+        out_len = ob.pos;
+        // 0 is the end of a frame, the next one continues with the same state
+        done = ret == 0;
+        return !ZSTD_isError(ret);
+    }
+
+    void reset() override { ZSTD_DCtx_reset(ds, ZSTD_reset_session_only); }
+
+private:
+    ZSTD_DStream* ds;
+};
+
+class ZstdEncoder : public Encoder {
+public:
+    explicit ZstdEncoder(FILE* _fout) : fout(_fout), cs(ZSTD_createCStream()) {
+        if (cs == nullptr) {
+            fprintf(stderr, "Error: Could not initialize zstd compression\n");
+            exit(1);
+        }
+    }
+    ~ZstdEncoder() override { ZSTD_freeCStream(cs); }
+
+    bool write(const char* data, size_t len) override { return run(data, len, ZSTD_e_continue); }
+    bool finish() override { return run(nullptr, 0, ZSTD_e_end); }
+
+private:
+    bool run(const char* data, size_t len, ZSTD_EndDirective mode) {
+        ZSTD_inBuffer ib = {data, len, 0};
+        size_t remaining;
+        do {
+            ZSTD_outBuffer ob = {out, sizeof(out), 0};
+            remaining = ZSTD_compressStream2(cs, &ob, &ib, mode);
+            if (ZSTD_isError(remaining)) return false;
+            if (fwrite(out, 1, ob.pos, fout) != ob.pos) return false;
+        } while (ib.pos < ib.size || (mode == ZSTD_e_end && remaining != 0));
+        return true;
+    }
+
+    FILE* fout;
+    ZSTD_CStream* cs;
+    char out[1U << 16];
+};
+#endif
+
+Decoder* new_decoder(Compression c) {
+    switch (c) {
+#ifdef USE_ZLIB
+        case Compression::Gzip: return new GzipDecoder();
+#endif
+#ifdef USE_LZMA
+        case Compression::Xz: return new XzDecoder();
+#endif
+#ifdef USE_ZSTD
+        case Compression::Zstd: return new ZstdDecoder();
+#endif
+        default: return nullptr;
+    }
+}
+
+Encoder* new_encoder(Compression c, FILE* fout) {
+    (void)fout;
+    switch (c) {
+#ifdef USE_ZLIB
+        case Compression::Gzip: return new GzipEncoder(fout);
+#endif
+#ifdef USE_LZMA
+        case Compression::Xz: return new XzEncoder(fout);
+#endif
+#ifdef USE_ZSTD
+        case Compression::Zstd: return new ZstdEncoder(fout);
+#endif
+        default: return nullptr;
+    }
+}
+
+Writer::Writer(FILE* _fout, Compression c) : fout(_fout) {
+    if (c != Compression::None) {
+        enc = new_encoder(c, fout);
+        if (enc == nullptr) {
+            fprintf(stderr, "Error: SBVA was built without %s support\n", compression_name(c));
+            exit(1);
+        }
+    }
+    buf = (char*)malloc(buf_sz);
+    if (buf == nullptr) {
+        fprintf(stderr, "Error: Could not allocate write buffer\n");
+        exit(1);
+    }
+}
+
+Writer::~Writer() {
+    delete enc;
+    free(buf);
+}
+
+void Writer::write_out(const char* s, size_t len) {
+    if (len == 0) return;
+    bool ok = enc != nullptr ? enc->write(s, len) : fwrite(s, 1, len, fout) == len;
+    if (!ok) write_error();
+}
+
+void Writer::flush() {
+    write_out(buf, used);
+    used = 0;
+}
+
+void Writer::finish() {
+    flush();
+    if (enc != nullptr && !enc->finish()) write_error();
+}
+
+}
+
+namespace SBVA {
+
+bool compression_supported(Compression c) {
+    if (c == Compression::None) return true;
+    SBVAImpl::Decoder* dec = SBVAImpl::new_decoder(c);
+    const bool ok = dec != nullptr;
+    delete dec;
+    return ok;
+}
+
+}
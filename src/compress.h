@@ -0,0 +1,149 @@
+/******************************************
+Copyright (C) 2024 Mate Soos
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+***********************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include "sbva.h"
+#include "bincnf.h"
+
+namespace SBVAImpl {
+
+using SBVA::Compression;
+
+// The compression of a stream, from its first n bytes. n may be less than
+// the length of a magic number, then it is Compression::None.
+Compression detect_compression(const unsigned char* p, size_t n);
+
+const char* compression_name(Compression c);
+
+// Streaming decompressor, it does not own any buffers
+class Decoder {
+public:
+    virtual ~Decoder() = default;
+
+    // Decompresses from [in, in_end) into out, advancing in. Sets out_len to
+    // the bytes written and done at the end of a compressed stream. Returns
+    // false on corrupt input.
+    virtual bool decode(const char*& in, const char* in_end, char* out, size_t out_cap,
+        size_t& out_len, bool& done) = 0;
+
+    // Starts a new stream, for inputs that are several concatenated ones
+    virtual void reset() = 0;
+};
+
+// Streaming compressor writing to fout
+class Encoder {
+public:
+    virtual ~Encoder() = default;
+
+    // Both return false if writing fails
+    virtual bool write(const char* data, size_t len) = 0;
+    virtual bool finish() = 0;
+};
+
+// Both return nullptr if this build does not support c
+Decoder* new_decoder(Compression c);
+Encoder* new_encoder(Compression c, FILE* fout);
+
+// Writes the decimal digits of v to p, which must have room for 20 bytes,
+// and returns the number of bytes written
+inline uint32_t format_int(char* p, int64_t v) {
+    static const char digits[] =
+        "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+        "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+        "8081828384858687888990919293949596979899";
+    char tmp[20];
+    char* const e = tmp + sizeof(tmp);
+    char* q = e;
+    uint64_t u = v < 0 ? 0 - (uint64_t)v : (uint64_t)v;
+    while (u >= 100) {
+        const uint32_t i = (u % 100) * 2;
+        u /= 100;
+        q -= 2;
+        memcpy(q, digits + i, 2);
+    }
+    if (u >= 10) {
+        q -= 2;
+        memcpy(q, digits + u * 2, 2);
+    } else {
+        *--q = (char)('0' + u);
+    }
+    uint32_t n = 0;
+    if (v < 0) p[n++] = '-';
+    memcpy(p + n, q, e - q);
+    return n + (e - q);
+}
+
+// Buffered output, compressed or not
+class Writer {
+public:
+    Writer(FILE* _fout, Compression c);
+    ~Writer();
+
+    Writer(const Writer&) = delete;
+    Writer& operator=(const Writer&) = delete;
+
+    void put(const char* s, size_t len) {
+        if (len > buf_sz - used) flush();
+        if (len > buf_sz) {
+            write_out(s, len);
+            return;
+        }
+        memcpy(buf + used, s, len);
+        used += len;
+    }
+    void put(const char* s) { put(s, strlen(s)); }
+    void put_int(int64_t val) {
+        if (buf_sz - used < 20) flush();
+        used += format_int(buf + used, val);
+    }
+
+    void put_varint(uint64_t val) {
+        if (buf_sz - used < 10) flush();
+        used += SBVAImpl::put_varint(buf + used, val);
+    }
+    void put_u32le(uint32_t val) {
+        const char b[4] = {(char)val, (char)(val >> 8), (char)(val >> 16), (char)(val >> 24)};
+        put(b, 4);
+    }
+
+    // Writes out everything, and the end of a compressed stream
+    void finish();
+
+    // Writes out the buffer, for uncompressed output that is everything
+    void flush();
+
+private:
+    void write_out(const char* s, size_t len);
+
+    FILE* fout;
+    Encoder* enc = nullptr;
+    char* buf;
+    size_t used = 0;
+    static constexpr size_t buf_sz = 1U << 20;
+};
+
+}
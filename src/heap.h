@@ -0,0 +1,78 @@
+/******************************************
+Copyright (C) 2024 Mate Soos
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+***********************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace SBVAImpl {
+
+// Max-heap of (count, literal) entries for the literal worklist. It pops in
+// exactly the order of the std::priority_queue SBVA has always used, so the
+// output does not change: ties on the count come out in the order that
+// push_heap/pop_heap leave them in, which depends on every push before.
+// Entries are never moved in place, as that would change the order of ties.
+// A literal whose count changed is pushed again, and the caller skips the
+// stale entry when it pops it, as its count is out of date.
+//
+// This makes it a std::priority_queue with its storage reserved up front.
+// It has no index of positions and no decrease-key, as updating entries in
+// place would pop ties in a different order.
+class Heap {
+public:
+    void reserve(size_t num_entries) { heap.reserve(num_entries); }
+
+    bool empty() const { return heap.empty(); }
+    size_t size() const { return heap.size(); }
+
+    void push(int count, int lit) {
+        heap.emplace_back(count, lit);
+        std::push_heap(heap.begin(), heap.end(), less);
+    }
+
+    int top_key() const {
+        assert(!empty());
+        return heap[0].first;
+    }
+
+    int pop() {
+        assert(!empty());
+        std::pop_heap(heap.begin(), heap.end(), less);
+        const int lit = heap.back().second;
+        heap.pop_back();
+        return lit;
+    }
+
+private:
+    // Only the count, as the std::priority_queue compared
+    static bool less(const std::pair<int, int>& a, const std::pair<int, int>& b) {
+        return a.first < b.first;
+    }
+
+    std::vector<std::pair<int, int>> heap;
+};
+
+}
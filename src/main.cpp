@@ -23,10 +23,13 @@ THE SOFTWARE.
 
 #include <cstdio>
 #include <cstdlib>
+#include <cstring>
 #include <ios>
+#include <iomanip>
 #include <iostream>
 #include <vector>
 #include <string>
+#include <algorithm>
 #include "sbva.h"
 #include "argparse.hpp"
 #include "time_mem.h"
@@ -43,20 +46,101 @@ using std::vector;
 
 using namespace SBVA;
 
-auto run_bva(FILE *fin, FILE *fout, FILE *fproof, Tiebreak tiebreak, Config& common) {
+bool ends_with(const string& fname, const char* ext) {
+    const size_t len = strlen(ext);
+    return fname.size() > len && fname.compare(fname.size() - len, len, ext) == 0;
+}
+
+// Output is compressed if its file name asks for it, input is recognised by
+// its contents
+Compression compression_for(const string& fname) {
+    if (ends_with(fname, ".gz")) return Compression::Gzip;
+    if (ends_with(fname, ".xz")) return Compression::Xz;
+    if (ends_with(fname, ".zst")) return Compression::Zstd;
+    return Compression::None;
+}
+
+// Binary if the file name, without any compression extension, ends in .bcnf
+bool is_binary_cnf(const string& fname) {
+    const string base = fname.substr(0, fname.find_last_of('.'));
+    return ends_with(fname, ".bcnf")
+        || (compression_for(fname) != Compression::None && ends_with(base, ".bcnf"));
+}
+
+FILE* open_output(const string& fname, Compression c) {
+    if (!compression_supported(c)) {
+        cerr << "Error: SBVA was built without support for writing " << fname << endl;
+        exit(1);
+    }
+    // Binary, the proof may be binary DRAT
+    return fopen(fname.c_str(), "wb");
+}
+
+auto run_bva(FILE *fin, FILE *fout, Compression out_comp, CnfFormat out_fmt, FILE *fproof,
+    Compression proof_comp, ProofFormat proof_fmt, Tiebreak tiebreak, Config& common)
+{
     CNF f;
+    double my_time = cpuTime();
     f.parse_cnf(fin, common);
+    if (common.verbosity)
+        cout << "c parsed CNF T: " << std::setprecision(2) << std::fixed
+            << (cpuTime() - my_time) << endl;
+
+    if (fproof != nullptr) f.set_proof_output(fproof, proof_comp, proof_fmt);
+
+    my_time = cpuTime();
     f.run(tiebreak);
-    auto ret = f.to_cnf(fout);
-    if (fproof != nullptr) f.to_proof(fproof);
+    if (common.verbosity)
+        cout << "c ran SBVA T: " << std::setprecision(2) << std::fixed
+            << (cpuTime() - my_time) << endl;
+
+    my_time = cpuTime();
+    auto ret = f.to_cnf(fout, out_comp, out_fmt);
+    if (common.verbosity)
+        cout << "c wrote output T: " << std::setprecision(2) << std::fixed
+            << (cpuTime() - my_time) << endl;
     return ret;
 }
 
+FILE* open_input(const string& fname) {
+    FILE* f = fopen(fname.c_str(), "rb");
+    if (f == nullptr) {
+        cerr << "Error: Could not open file " << fname << " for reading" << endl;
+        exit(1);
+    }
+    return f;
+}
+
+// Nothing is written, the output file is read back
+int verify(const vector<string>& files, const string& proof_fname, Config& config) {
+    if (files.size() != 2) {
+        cerr << "Error: --verify needs the input and the output file" << endl;
+        return 1;
+    }
+    FILE* fin = open_input(files[0]);
+    FILE* fout = open_input(files[1]);
+    FILE* fproof = open_input(proof_fname);
+    const double my_time = cpuTime();
+    string error;
+    const bool ok = verify_proof(fin, fout, fproof, config, error);
+    fclose(fin);
+    fclose(fout);
+    fclose(fproof);
+    if (!ok) cout << "c " << error << endl;
+    cout << "c verification T: " << std::setprecision(2) << std::fixed << (cpuTime() - my_time) << endl;
+    cout << (ok ? "s VERIFIED" : "s NOT VERIFIED") << endl;
+    return ok ? 0 : 1;
+}
+
 argparse::ArgumentParser program = argparse::ArgumentParser("sbva");
 int main(int argc, char **argv) {
     Config config;
     FILE *fproof = nullptr;
+    Compression proof_comp = Compression::None;
+    bool bin_hashes = false;
+    ProofFormat proof_fmt = ProofFormat::Drat;
     Tiebreak tiebreak = Tiebreak::ThreeHop;
+    string verify_fname;
 
     program.add_argument("-v", "--verb")
         .action([&](const auto& a) {config.verbosity = std::atoi(a.c_str());})
@@ -65,12 +149,13 @@ int main(int argc, char **argv) {
     program.add_argument("-p", "--proof")
         .action([&](const auto& a) {
                 config.generate_proof = true;
-                fproof = fopen(a.c_str(), "w");
+                proof_comp = compression_for(a);
+                fproof = open_output(a, proof_comp);
                 if (fproof == nullptr) {
                 std::cerr << "Error: Could not open file " << a << " for reading" << endl;
                 }
         })
-        .help("Emit proof file here");
+        .help("Emit proof file here. Compressed if it ends in .gz, .xz or .zst");
     program.add_argument("-s", "--steps")
         .action([&](const auto& a) {config.steps = 1e6 * std::atoll(a.c_str());})
         .default_value(config.steps)
@@ -79,10 +164,33 @@ int main(int argc, char **argv) {
         .action([&](const auto& a) {config.max_replacements = std::atoi(a.c_str());})
         .default_value(config.max_replacements)
         .help("Maximum number of replacements to do. 0 = no limit");
+    program.add_argument("-t", "--threads")
+        .action([&](const auto& a) {config.num_threads = std::max(1, std::atoi(a.c_str()));})
+        .default_value(config.num_threads)
+        .help("Number of threads to use for the parallel parts");
     program.add_argument("-n", "--normal")
         .action([&](const auto&) {tiebreak = Tiebreak::None;})
         .flag()
         .help("Use original BVA tie-break. Runs BVA instead of SBVA");
+    program.add_argument("--partneridx")
+        .action([&](const auto&) {config.partner_index = true;})
+        .flag()
+        .help("Find partner clauses through a hash index instead of scanning occurrence lists. Uses 16 bytes per literal of the CNF");
+    program.add_argument("--sortdedup")
+        .action([&](const auto&) {config.dedup_sort = true;})
+        .flag()
+        .help("Remove duplicate clauses by sorting once loaded instead of a hash table. Uses less memory on huge inputs");
+    program.add_argument("--binproof")
+        .action([&](const auto&) {proof_fmt = ProofFormat::BinaryDrat;})
+        .flag()
+        .help("Write the proof in binary DRAT");
+    program.add_argument("--binhash")
+        .action([&](const auto&) {bin_hashes = true;})
+        .flag()
+        .help("Store clause hashes in binary output, so that SBVA loads it faster");
+    program.add_argument("--verify")
+        .action([&](const auto& a) {verify_fname = a;})
+        .help("Check that this proof turns the input file into the output file, instead of running SBVA");
     program.add_argument("--clscutoff")
         .action([&](const auto& a) {config.matched_cls_cutoff = std::atoi(a.c_str());})
         .help("Matched clauses cutoff. The larger, the larger the gain must be to perform BVA");
@@ -93,7 +201,7 @@ int main(int argc, char **argv) {
         .action([&](const auto&) {config.preserve_model_cnt = true;})
         .flag()
         .help("Preserve model count. Adds additional clauses but allows the tool to be used in propositional model ");
-    program.add_argument("files").remaining().help("input file and output file");
+    program.add_argument("files").remaining().help("input file and output file. Input may be DIMACS or binary, and gzip, xz or zstd compressed. Output is binary if it ends in .bcnf, and compressed if it ends in .gz, .xz or .zst");
 
 
     #if defined(__GNUC__) && defined(__linux__)
@@ -128,6 +236,8 @@ int main(int argc, char **argv) {
 
     FILE *fin = stdin;
     FILE *fout = stdout;
+    Compression out_comp = Compression::None;
+    CnfFormat out_fmt = CnfFormat::Dimacs;
 
     //parsing the input
     vector<std::string> files;
@@ -141,10 +251,12 @@ int main(int argc, char **argv) {
         //exit(-1);
     }
 
+    if (!verify_fname.empty()) return verify(files, verify_fname, config);
+
     auto my_time = cpuTime();
     if (!files.empty()) {
         const string in_fname = files[0];
-        fin = fopen(in_fname.c_str(), "r");
+        fin = fopen(in_fname.c_str(), "rb");
         if (fin == nullptr) {
             cerr << "Error: Could not open file " << in_fname << " for reading" << endl;
             return 1;
@@ -154,7 +266,9 @@ int main(int argc, char **argv) {
 
     if (files.size() >= 2) {
         const string out_fname = files[1];
-        fout = fopen(out_fname.c_str(), "w");
+        out_comp = compression_for(out_fname);
+        if (is_binary_cnf(out_fname)) out_fmt = bin_hashes ? CnfFormat::BinaryHashes : CnfFormat::Binary;
+        fout = open_output(out_fname, out_comp);
         if (fout == nullptr) {
             cerr << "Error: Could not open file " << out_fname << " for writing" << endl;
             return 1;
@@ -162,7 +276,7 @@ int main(int argc, char **argv) {
         cout << "c writing transformed CNF to file " << out_fname << endl;
     } else cout << "c writing transformed CNF to stdout..." << endl;
 
-    auto ret = run_bva(fin, fout, fproof, tiebreak, config);
+    auto ret = run_bva(fin, fout, out_comp, out_fmt, fproof, proof_comp, proof_fmt, tiebreak, config);
     cout << "c SBVA Finished. Num vars now: " << ret.first << " num cls: " << ret.second << endl;
     cout << "c steps remainK: " << std::setprecision(2) << std::fixed << (double)config.steps/1000.0
            << " Timeout: " << (config.steps <= 0 ? "Yes" : "No")
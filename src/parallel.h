@@ -0,0 +1,54 @@
+/******************************************
+Copyright (C) 2024 Mate Soos
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+***********************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+namespace SBVAImpl {
+
+// Splits [0, n) into num_threads contiguous ranges and calls
+// f(thread_id, begin, end) for each, on its own thread. The calling thread
+// does the first range. With one thread, or less than one item per thread,
+// everything runs on the caller.
+template<class F>
+void parallel_for(size_t n, uint32_t num_threads, F f) {
+    if (num_threads <= 1 || n < num_threads) {
+        f(0U, (size_t)0, n);
+        return;
+    }
+
+    std::vector<std::thread> threads;
+    threads.reserve(num_threads-1);
+    for (uint32_t t = 1; t < num_threads; t++) {
+        size_t begin = n * t / num_threads;
+        size_t end = n * (t+1) / num_threads;
+        threads.emplace_back([=, &f]() { f(t, begin, end); });
+    }
+    f(0U, (size_t)0, n / num_threads);
+    for (auto& th : threads) th.join();
+}
+
+}
@@ -0,0 +1,139 @@
+/******************************************
+Copyright (C) 2024 Mate Soos
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+***********************************************/
+
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <vector>
+
+namespace SBVAImpl {
+
+// Multiset hash of a literal. A clause hashes to the sum of its literals, so
+// removing or adding one literal is a single subtraction or addition.
+inline uint64_t zobrist_lit(int32_t lit) {
+    uint64_t z = (uint64_t)(uint32_t)lit + 0x9E3779B97F4A7C15ULL;
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+// Index of every clause with each of its literals left out once. The entry
+// (key, offs, lit) says that hash(clause at offs) - zobrist_lit(lit) == key,
+// so all clauses D with D \ {x} == C \ {l} are found with one lookup of
+// hash(C) - zobrist_lit(l). Different multisets can share a key, callers
+// have to check the clauses they get back.
+//
+// Open addressing with linear probing. Removed entries become tombstones
+// until the next rehash. Several entries may have the same key.
+class PartnerIndex {
+public:
+    struct Entry {
+        uint64_t key;
+        uint32_t offs;
+        int32_t lit;
+    };
+
+    void clear() {
+        table.clear();
+        used = 0;
+        dead = 0;
+    }
+
+    void reserve(size_t num) {
+        size_t cap = 16;
+        while (cap < num * 2) cap *= 2;
+        if (cap > table.size()) rehash(cap);
+    }
+
+    void add(uint64_t key, uint32_t offs, int32_t lit) {
+        if ((used + dead + 1) * 2 > table.size()) {
+            // Grow if mostly live, otherwise just clear out the tombstones
+            if (table.empty()) rehash(16);
+            else rehash(used * 4 > table.size() ? table.size() * 2 : table.size());
+        }
+        size_t i = slot(key);
+        while (table[i].offs != empty && table[i].offs != tombstone) i = (i + 1) & mask;
+        if (table[i].offs == tombstone) dead--;
+        table[i] = Entry{key, offs, lit};
+        used++;
+    }
+
+    void remove(uint64_t key, uint32_t offs, int32_t lit) {
+        for (size_t i = slot(key); table[i].offs != empty; i = (i + 1) & mask) {
+            if (table[i].key == key && table[i].offs == offs && table[i].lit == lit) {
+                table[i].offs = tombstone;
+                used--;
+                dead++;
+                return;
+            }
+        }
+        assert(false && "removing an entry that is not in the partner index");
+    }
+
+    // Calls f(offs, lit) for every entry with this key and returns the number
+    // of slots probed
+    template<class F>
+    size_t find(uint64_t key, F f) const {
+        if (table.empty()) return 0;
+        size_t probed = 0;
+        for (size_t i = slot(key); table[i].offs != empty; i = (i + 1) & mask) {
+            probed++;
+            if (table[i].key == key && table[i].offs != tombstone) f(table[i].offs, table[i].lit);
+        }
+        return probed;
+    }
+
+    size_t size() const { return used; }
+    size_t mem_used() const { return table.capacity() * sizeof(Entry); }
+
+private:
+    static constexpr uint32_t empty = UINT32_MAX;
+    static constexpr uint32_t tombstone = UINT32_MAX - 1;
+
+    size_t slot(uint64_t key) const {
+        return (key ^ (key >> 29)) & mask;
+    }
+
+    void rehash(size_t cap) {
+        std::vector<Entry> old;
+        old.swap(table);
+        table.assign(cap, Entry{0, empty, 0});
+        mask = cap - 1;
+        dead = 0;
+        for (const auto& e : old) {
+            if (e.offs == empty || e.offs == tombstone) continue;
+            size_t i = slot(e.key);
+            while (table[i].offs != empty) i = (i + 1) & mask;
+            table[i] = e;
+        }
+    }
+
+    std::vector<Entry> table;
+    size_t mask = 0;
+    size_t used = 0;
+    size_t dead = 0;
+};
+
+}
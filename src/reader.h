@@ -0,0 +1,286 @@
+/******************************************
+Copyright (C) 2024 Mate Soos
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+***********************************************/
+
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <climits>
+#include "compress.h"
+
+#if !defined(_WIN32)
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <unistd.h>
+#endif
+
+namespace SBVAImpl {
+
+// Byte source for the DIMACS scanner. Regular files are memory-mapped and
+// scanned in place; pipes and stdin are read in large blocks. Compressed
+// input is recognised by its magic number and decompressed block by block,
+// from the mapping or the read blocks.
+class Reader {
+public:
+    explicit Reader(FILE* _fin) : fin(_fin) {
+        try_mmap();
+        if (map == nullptr) {
+            buf = alloc_buf();
+            refill();
+        }
+        comp = detect_compression((const unsigned char*)cur, end - cur);
+        if (comp != Compression::None) start_decoding();
+    }
+
+    // Scans the bytes [_cur, _end) of memory owned by the caller
+    Reader(const char* _cur, const char* _end) : fin(nullptr), at_eof(true), cur(_cur), end(_end) {}
+
+    ~Reader() {
+#if !defined(_WIN32)
+        if (map != nullptr) munmap(map, map_sz);
+#endif
+        free(buf);
+        free(raw);
+        delete dec;
+    }
+
+    Reader(const Reader&) = delete;
+    Reader& operator=(const Reader&) = delete;
+
+    // Next byte without consuming it, EOF at end of input.
+    inline int peek() {
+        if (cur == end && !refill()) return EOF;
+        return (unsigned char)*cur;
+    }
+
+    inline void advance() { cur++; }
+
+    void skip_whitespace() {
+        int c;
+        while ((c = peek()) == ' ' || c == '\t' || c == '\n' || c == '\r') advance();
+    }
+
+    void skip_line() {
+        int c;
+        while ((c = peek()) != EOF) {
+            advance();
+            if (c == '\n') break;
+        }
+    }
+
+    // Consumes the exact string s, returns false on the first mismatch.
+    bool expect(const char* s) {
+        for (; *s; s++) {
+            if (peek() != (unsigned char)*s) return false;
+            advance();
+        }
+        return true;
+    }
+
+    // Parses a signed decimal integer at the current position. Leading
+    // whitespace is not skipped. Returns false if there is no number here or
+    // it does not fit into an int.
+    bool parse_int(int& ret) {
+        bool neg = false;
+        int c = peek();
+        if (c == '-') {
+            neg = true;
+            advance();
+            c = peek();
+        }
+        if (c < '0' || c > '9') return false;
+
+        int64_t val = 0;
+        do {
+            val = val * 10 + (c - '0');
+            if (val > INT_MAX) return false;
+            advance();
+            c = peek();
+        } while (c >= '0' && c <= '9');
+
+        ret = neg ? -(int)val : (int)val;
+        return true;
+    }
+
+    // Reads a varint of the binary CNF format. Returns false at the end of
+    // the input or if it is longer than 64 bits.
+    bool read_varint(uint64_t& ret) {
+        uint64_t val = 0;
+        for (uint32_t shift = 0; shift < 64; shift += 7) {
+            int c = peek();
+            if (c == EOF) return false;
+            advance();
+            val |= (uint64_t)(c & 0x7f) << shift;
+            if (c < 0x80) {
+                ret = val;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool read_u32le(uint32_t& ret) {
+        uint32_t val = 0;
+        for (uint32_t i = 0; i < 4; i++) {
+            int c = peek();
+            if (c == EOF) return false;
+            advance();
+            val |= (uint32_t)c << (8 * i);
+        }
+        ret = val;
+        return true;
+    }
+
+    // Whether the whole input is in memory as text
+    bool is_mmapped() const { return map != nullptr && dec == nullptr; }
+
+    Compression compression() const { return comp; }
+
+    // The unread part of a memory-mapped input, so that it can be split, or
+    // of the current block otherwise
+    void remaining(const char*& b, const char*& e) const {
+        b = cur;
+        e = end;
+    }
+
+private:
+    void try_mmap() {
+#if !defined(_WIN32)
+        int fd = fileno(fin);
+        if (fd < 0) return;
+        struct stat st;
+        if (fstat(fd, &st) != 0 || !S_ISREG(st.st_mode) || st.st_size == 0) return;
+
+        // Respect anything the caller has already consumed from the stream
+        off_t start = ftello(fin);
+        if (start < 0 || start >= st.st_size) return;
+
+        void* m = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (m == MAP_FAILED) return;
+#ifdef MADV_SEQUENTIAL
+        madvise(m, st.st_size, MADV_SEQUENTIAL);
+#endif
+        map = (char*)m;
+        map_sz = st.st_size;
+        cur = map + start;
+        end = map + map_sz;
+#endif
+    }
+
+    static char* alloc_buf() {
+        char* b = (char*)malloc(buf_sz);
+        if (b == nullptr) {
+            fprintf(stderr, "Error: Could not allocate read buffer\n");
+            exit(1);
+        }
+        return b;
+    }
+
+    // The bytes read so far become the compressed input, and buf takes the
+    // decompressed text
+    void start_decoding() {
+        dec = new_decoder(comp);
+        if (dec == nullptr) {
+            fprintf(stderr, "Error: Input is %s compressed, but SBVA was built without %s support\n",
+                compression_name(comp), compression_name(comp));
+            exit(1);
+        }
+        raw_cur = cur;
+        raw_end = end;
+        if (map == nullptr) raw = buf;
+        buf = alloc_buf();
+        cur = end = buf;
+    }
+
+    // Next block of compressed input, if it is not mapped
+    bool read_raw() {
+        if (map != nullptr || at_eof) return false;
+        size_t got = fread(raw, 1, buf_sz, fin);
+        if (got == 0) {
+            at_eof = true;
+            return false;
+        }
+        raw_cur = raw;
+        raw_end = raw + got;
+        return true;
+    }
+
+    // A stream that has ended may be followed by another one, as written by
+    // e.g. pigz or pxz
+    bool refill_decoded() {
+        while (true) {
+            if (stream_done) {
+                if (raw_cur == raw_end && !read_raw()) return false;
+                dec->reset();
+                stream_done = false;
+            }
+            size_t len = 0;
+            if (!dec->decode(raw_cur, raw_end, buf, buf_sz, len, stream_done)) {
+                fprintf(stderr, "Error: Corrupt %s compressed input\n", compression_name(comp));
+                exit(1);
+            }
+            if (len > 0) {
+                cur = buf;
+                end = buf + len;
+                return true;
+            }
+            if (!stream_done && raw_cur == raw_end && !read_raw()) {
+                fprintf(stderr, "Error: Truncated %s compressed input\n", compression_name(comp));
+                exit(1);
+            }
+        }
+    }
+
+    bool refill() {
+        if (dec != nullptr) return refill_decoded();
+        if (map != nullptr || at_eof) return false;
+        size_t got = fread(buf, 1, buf_sz, fin);
+        if (got == 0) {
+            at_eof = true;
+            return false;
+        }
+        cur = buf;
+        end = buf + got;
+        return true;
+    }
+
+    FILE* fin;
+    char* map = nullptr;
+    size_t map_sz = 0;
+    char* buf = nullptr;
+    static constexpr size_t buf_sz = 1U << 20;
+    bool at_eof = false;
+    const char* cur = nullptr;
+    const char* end = nullptr;
+
+    // Compressed input, raw is only used if it is not mapped
+    Compression comp = Compression::None;
+    Decoder* dec = nullptr;
+    char* raw = nullptr;
+    const char* raw_cur = nullptr;
+    const char* raw_end = nullptr;
+    bool stream_done = false;
+};
+
+}
@@ -25,100 +25,224 @@ THE SOFTWARE.
 #include <cstdlib>
 #include <cstring>
 #include <iostream>
-#include <queue>
 #include <vector>
 #include <algorithm>
-#include <unordered_set>
 #include <tuple>
-#include <set>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
 #include <iomanip>
+#include <limits>
+#include <cassert>
 
 #include <cstdio>
 #include <utility>
 
-#include <Eigen/SparseCore>
 #include "murmur.h"
 #include "sbva.h"
 #include "GitSHA1.hpp"
-#include "getline.h"
+#include "reader.h"
+#include "compress.h"
+#include "bincnf.h"
+#include "heap.h"
+#include "clause_diff.h"
+#include "partner.h"
+#include "parallel.h"
+#include "time_mem.h"
 
 using namespace std;
 
 namespace SBVAImpl {
 
-struct Clause {
-    bool deleted;
-    vector<int> lits;
-    mutable uint32_t hash = 0;
+typedef uint32_t ClOffset;
 
-    Clause() {
-        deleted = false;
-    }
-
-    void print(const std::string extra = "") {
+// Clause header, immediately followed by its literals in the ClauseAllocator
+// arena. Only ever accessed through ClauseAllocator::ptr().
+struct Clause {
+    static constexpr uint32_t header_words = 3;
+
+    uint32_t sz;
+    uint32_t deleted : 1;
+    uint32_t unused : 31;
+    mutable uint32_t hash;
+
+    uint32_t size() const { return sz; }
+    int* begin() { return (int*)(this + 1); }
+    int* end() { return begin() + sz; }
+    const int* begin() const { return (const int*)(this + 1); }
+    const int* end() const { return begin() + sz; }
+    int& operator[](uint32_t i) { return begin()[i]; }
+    int operator[](uint32_t i) const { return begin()[i]; }
+
+    void print(const std::string extra = "") const {
         if (deleted) {
             cout << extra << "DELETED: ";
         } else cout << extra;
-        for (int lit : lits) cout << lit << " ";
+        for (int lit : *this) cout << lit << " ";
         cout << endl;
     }
 
+    // Never 0, so that a clause is hashed only once
     uint32_t hash_val() const {
         if (hash == 0) {
-            hash = murmur3_vec((uint32_t *) lits.data(), lits.size(), 0);
+            hash = std::max(murmur3_vec((uint32_t *) begin(), sz, 0), 1U);
         }
         return hash;
     }
 
     bool operator==(const Clause &other) const {
-        if (lits.size() != other.lits.size()) {
+        if (sz != other.sz) {
             return false;
         }
-        for (size_t i = 0; i < lits.size(); i++) {
-            if (lits[i] != other.lits[i]) {
+        for (uint32_t i = 0; i < sz; i++) {
+            if ((*this)[i] != other[i]) {
                 return false;
             }
         }
         return true;
     }
 };
+static_assert(sizeof(Clause) == Clause::header_words * sizeof(uint32_t), "Clause header must be packed");
 
+// All clauses live back to back in one flat arena. A clause is referenced by
+// its 32-bit offset, which, unlike a pointer, survives the arena growing.
+class ClauseAllocator {
+public:
+    ClOffset alloc(const int* lits, uint32_t sz) {
+        ClOffset offs = mem.size();
+        if ((uint64_t)offs + Clause::header_words + sz > std::numeric_limits<ClOffset>::max()) {
+            fprintf(stderr, "Error: too many literals for the clause arena\n");
+            exit(1);
+        }
+        mem.resize(mem.size() + Clause::header_words + sz);
+        Clause* c = ptr(offs);
+        c->sz = sz;
+        c->deleted = 0;
+        c->unused = 0;
+        c->hash = 0;
+        if (sz > 0) memcpy(c->begin(), lits, sz * sizeof(int));
+        return offs;
+    }
 
-struct ProofClause {
-    bool is_addition;
-    vector<int> lits;
-
-    ProofClause(bool _is_addition, vector<int> _lits) {
-        this->is_addition = _is_addition;
-        this->lits = _lits;
+    Clause* ptr(ClOffset offs) { return (Clause*)(mem.data() + offs); }
+    const Clause* ptr(ClOffset offs) const { return (const Clause*)(mem.data() + offs); }
+
+    // Offset of the clause following the one at offs, in allocation order
+    ClOffset next(ClOffset offs) const { return offs + Clause::header_words + ptr(offs)->size(); }
+    ClOffset end_offset() const { return mem.size(); }
+
+    // Removing the deleted clauses goes in two steps. plan_compact() gives
+    // every live clause its new offset, keeping their order, and the caller
+    // then maps its references with relocated(). finish_compact() moves the
+    // clauses. In between, the hash field of a live clause holds its new
+    // offset, clause hashes are only needed while loading.
+    ClOffset plan_compact() {
+        ClOffset write = 0;
+        for (ClOffset offs = 0; offs < end_offset(); offs = next(offs)) {
+            Clause* c = ptr(offs);
+            if (c->deleted) continue;
+            c->hash = write;
+            write += Clause::header_words + c->size();
+        }
+        return write;
     }
-};
 
+    ClOffset relocated(ClOffset offs) const {
+        assert(!ptr(offs)->deleted);
+        return ptr(offs)->hash;
+    }
 
-struct ClauseHash {
-    size_t operator()(const Clause &c) const {
-        return c.hash_val();
+    void finish_compact() {
+        ClOffset write = 0;
+        for (ClOffset offs = 0; offs < end_offset();) {
+            Clause* c = ptr(offs);
+            const uint32_t words = Clause::header_words + c->size();
+            if (!c->deleted) {
+                assert(c->hash == write);
+                c->hash = 0;
+                if (write != offs) memmove(mem.data() + write, mem.data() + offs, words * sizeof(uint32_t));
+                write += words;
+            }
+            offs += words;
+        }
+        mem.resize(write);
     }
+
+    void reserve(size_t words) { mem.reserve(words); }
+    size_t mem_used() const { return mem.capacity() * sizeof(uint32_t); }
+
+private:
+    vector<uint32_t> mem;
 };
 
-struct ClauseCache {
-    unordered_set<Clause, ClauseHash> clauses;
 
-    ClauseCache() = default;
 
-    void add(Clause *c) {
-        clauses.insert(*c);
+
+// Set of the clauses seen so far during loading. Open addressing over
+// (hash, offset) pairs, the clauses themselves are only in the arena, and the
+// stored hash avoids touching them on most probes.
+class ClauseCache {
+public:
+    explicit ClauseCache(const ClauseAllocator& _ca) : ca(_ca) {}
+
+    // Adds the clause at offs, unless an equal one is in already. Returns
+    // false for a duplicate.
+    bool insert(ClOffset offs) {
+        if ((used + 1) * 2 > table.size()) grow();
+        const Clause* cls = ca.ptr(offs);
+        const uint32_t h = cls->hash_val();
+        for (size_t i = h & mask;; i = (i + 1) & mask) {
+            if (table[i].offs == empty) {
+                table[i] = Slot{h, offs};
+                used++;
+                return true;
+            }
+            if (table[i].hash == h && *ca.ptr(table[i].offs) == *cls) return false;
+        }
     }
 
-    bool contains(Clause *c) {
-        return clauses.find(*c) != clauses.end();
+    size_t mem_used() const { return table.capacity() * sizeof(Slot); }
+
+private:
+    struct Slot {
+        uint32_t hash;
+        ClOffset offs;
+    };
+    static constexpr ClOffset empty = std::numeric_limits<ClOffset>::max();
+
+    void grow() {
+        vector<Slot> old;
+        old.swap(table);
+        table.assign(old.empty() ? 1024 : old.size() * 2, Slot{0, empty});
+        mask = table.size() - 1;
+        for (const auto& e : old) {
+            if (e.offs == empty) continue;
+            size_t i = e.hash & mask;
+            while (table[i].offs != empty) i = (i + 1) & mask;
+            table[i] = e;
+        }
     }
+
+    const ClauseAllocator& ca;
+    vector<Slot> table;
+    size_t mask = 0;
+    size_t used = 0;
 };
 
 uint32_t lit_index(int32_t lit) {
     return (lit > 0 ? lit * 2 - 2 : -lit * 2 - 1);
 }
 
+int32_t index_lit(uint32_t idx) {
+    return (idx & 1) ? -(int32_t)((idx+1) >> 1) : (int32_t)(idx >> 1) + 1;
+}
+
+// One bit per literal, the signature of a clause is the OR of its literals'
+uint64_t lit_sig(int32_t lit) {
+    return 1ULL << (lit_index(lit) & 63);
+}
+
 uint32_t sparsevec_lit_idx(int32_t lit) {
     return (lit > 0 ? lit - 1: -lit - 1);
 }
@@ -127,34 +251,236 @@ uint32_t sparcevec_lit_for_idx(int32_t lit) {
     return (lit + 1);
 }
 
+// One row of the variable adjacency matrix: for every variable, the number of
+// clauses it shares with the row's variable. Stored as (index, count) pairs
+// sorted by index, so a row never needs to know the number of variables.
+struct AdjRow {
+    struct Entry {
+        uint32_t idx;
+        int count;
+    };
+    vector<Entry> entries;
+    bool built = false;
+    bool has_zeros = false;
+
+    uint32_t nonZeros() const { return entries.size(); }
+
+    // Adjusts the count of idx by delta. Entries that drop to zero are kept
+    // until remove_zeros() so that positions stay stable during an update.
+    void add(uint32_t idx, int delta) {
+        auto it = std::lower_bound(entries.begin(), entries.end(), idx,
+            [](const Entry& e, uint32_t i) { return e.idx < i; });
+        if (it != entries.end() && it->idx == idx) {
+            it->count += delta;
+            assert(it->count >= 0);
+            has_zeros |= (it->count == 0);
+        } else {
+            assert(delta > 0);
+            if (entries.size() == entries.capacity()) {
+                // Rows mostly gain a single entry (the new variable), so
+                // grow gently instead of doubling
+                size_t pos = it - entries.begin();
+                entries.reserve(entries.size() + entries.size()/8 + 4);
+                it = entries.begin() + pos;
+            }
+            entries.insert(it, Entry{idx, delta});
+        }
+    }
+
+    void remove_zeros() {
+        if (!has_zeros) return;
+        entries.erase(std::remove_if(entries.begin(), entries.end(),
+            [](const Entry& e) { return e.count == 0; }), entries.end());
+        has_zeros = false;
+    }
+
+    // Builds the row from a list of variable indices, one per occurrence.
+    // The list is sorted in place.
+    void build(vector<uint32_t>& idxs) {
+        std::sort(idxs.begin(), idxs.end());
+        size_t distinct = 0;
+        for (size_t i = 0; i < idxs.size(); i++) {
+            distinct += (i == 0 || idxs[i] != idxs[i-1]);
+        }
+        entries.clear();
+        entries.shrink_to_fit();
+        entries.reserve(distinct);
+        for (size_t i = 0; i < idxs.size();) {
+            size_t j = i;
+            while (j < idxs.size() && idxs[j] == idxs[i]) j++;
+            entries.push_back(Entry{idxs[i], (int)(j-i)});
+            i = j;
+        }
+        built = true;
+    }
+
+    int dot(const AdjRow& other) const {
+        int ret = 0;
+        auto a = entries.begin();
+        auto b = other.entries.begin();
+        while (a != entries.end() && b != other.entries.end()) {
+            if (a->idx == b->idx) {
+                ret += a->count * b->count;
+                a++;
+                b++;
+            } else if (a->idx < b->idx) {
+                a++;
+            } else {
+                b++;
+            }
+        }
+        return ret;
+    }
+};
+
+// Tie-break scores that outlive a single outer iteration of run_sbva, keyed
+// by the variable indices of the two literals. Direct-mapped with a fixed
+// number of slots, a colliding key simply overwrites the old entry. Whether an
+// entry is still valid is decided by the caller from the stored version.
+class TieCache {
+public:
+    struct Entry {
+        uint32_t idx1 = std::numeric_limits<uint32_t>::max();
+        uint32_t idx2 = 0;
+        uint32_t version = 0;
+        int score = 0;
+
+        bool matches(uint32_t a, uint32_t b) const {
+            return idx1 == std::min(a, b) && idx2 == std::max(a, b);
+        }
+    };
+
+    // The heuristic is symmetric in the two variables, so is the key
+    Entry& slot(uint32_t idx1, uint32_t idx2) {
+        // Allocated on first use, most formulas never need a tie-break
+        if (table.empty()) table.resize(size_t(1) << bits);
+        if (idx1 > idx2) std::swap(idx1, idx2);
+        uint64_t h = (((uint64_t)idx1 << 32) | idx2) * 0x9E3779B97F4A7C15ULL;
+        return table[h >> (64 - bits)];
+    }
+
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+
+private:
+    static constexpr uint32_t bits = 16;
+    vector<Entry> table;
+};
+
+// One clause in the occurrence list of a literal. The size and the literal
+// signature are kept inline so that a list can be ordered, and searched, by
+// clause size, and most non-partners rejected, without touching the clauses.
+struct OccEntry {
+    ClOffset offs;
+    uint32_t size;
+    uint64_t sig;
+
+    bool operator<(const OccEntry& other) const {
+        return size < other.size || (size == other.size && offs < other.offs);
+    }
+};
+
+// Ordered by clause size, then offset. Clauses of one size form a bucket in
+// allocation order.
+typedef vector<OccEntry> OccList;
+
+// Scratch space for one outer iteration of run_sbva, kept across iterations
+// so that an iteration that does not replace anything allocates nothing.
+// Membership is kept as per-literal (or per clause id) stamps of the current
+// epoch, so starting a new iteration clears every set in O(1).
+class MatchWorkspace {
+public:
+    void grow(size_t num_lits) {
+        if (num_lits <= lit_matched.size()) return;
+        lit_matched.resize(num_lits, 0);
+        lit_update.resize(num_lits, 0);
+        lit_count.resize(num_lits, 0);
+    }
+
+    void new_iteration() {
+        epoch++;
+        if (epoch == 0) {
+            std::fill(lit_matched.begin(), lit_matched.end(), 0);
+            std::fill(lit_update.begin(), lit_update.end(), 0);
+            std::fill(clause_id.begin(), clause_id.end(), 0);
+            epoch = 1;
+        }
+        to_update.clear();
+    }
+
+    // Mlit
+    void set_matched(int lit) { lit_matched[lit_index(lit)] = epoch; }
+    bool is_matched(int lit) const { return lit_matched[lit_index(lit)] == epoch; }
+
+    // Number of partner clauses found for each literal of P. Every literal
+    // with a count is in counted, reset_counts() must be called before the
+    // next round of counting.
+    void count(int lit) {
+        int& c = lit_count[lit_index(lit)];
+        if (c == 0) counted.push_back(lit);
+        c++;
+    }
+    int get_count(int lit) const { return lit_count[lit_index(lit)]; }
+    void reset_counts() {
+        for (int lit : counted) lit_count[lit_index(lit)] = 0;
+        counted.clear();
+    }
+
+    // Ids, within F[l], of the clauses to remove
+    void set_clause_id(uint32_t id) {
+        if (id >= clause_id.size()) clause_id.resize(id + 1, 0);
+        clause_id[id] = epoch;
+    }
+    bool has_clause_id(uint32_t id) const { return id < clause_id.size() && clause_id[id] == epoch; }
+
+    // Literals whose priority has to be updated, each once
+    void set_update(int lit) {
+        uint32_t& s = lit_update[lit_index(lit)];
+        if (s == epoch) return;
+        s = epoch;
+        to_update.push_back(lit);
+    }
+
+    vector<int> counted;
+    vector<int> ties;
+    vector<int> to_update;
+
+private:
+    uint32_t epoch = 0;
+    vector<uint32_t> lit_matched;
+    vector<uint32_t> lit_update;
+    vector<int> lit_count;
+    vector<uint32_t> clause_id;
+};
+
 int reduction(int lits, int clauses) {
     return (lits * clauses) - (lits + clauses);
 }
 
 class Formula {
 public:
+    Formula(SBVA::Config& _config) : config(_config) { }
+
     ~Formula() {
-        delete cache;
+        delete proof_out;
+        if (proof_spill != nullptr) fclose(proof_spill);
     }
 
-    Formula(SBVA::Config& _config) : config(_config) { }
-
     void init_cnf(uint32_t _num_vars) {
         num_vars = _num_vars;
         lit_count_adjust.resize(num_vars * 2);
         lit_to_clauses.resize(num_vars * 2);
-        adjacency_matrix_width = num_vars * 4;
+        occ_sorted.resize(num_vars * 2);
         adjacency_matrix.resize(num_vars);
+        var_version.resize(num_vars, 0);
         found_header = true;
         curr_clause = 0;
-        assert(cache == nullptr);
-        cache = new ClauseCache;
     }
 
-    void add_cl(const vector<int>& cl_lits) {
+    // Only stores the clause, sorting, duplicate removal and the occurrence
+    // lists are done for all clauses at once by finish_cnf()
+    ClOffset add_cl(const vector<int>& cl_lits) {
         assert(found_header);
-        clauses.push_back(Clause());
-        assert(curr_clause == clauses.size()-1);
 
         for(const auto& lit: cl_lits) {
             assert(lit != 0);
@@ -162,213 +488,988 @@ public:
                 fprintf(stderr, "Error: CNF file has a variable that is greater than the number of variables specified in the header\n");
                 exit(1);
             }
-            config.steps--;
-            clauses[(curr_clause)].lits.push_back(lit);
         }
 
-        sort(clauses[(curr_clause)].lits.begin(), clauses[(curr_clause)].lits.end());
+        ClOffset offs = ca.alloc(cl_lits.data(), cl_lits.size());
+        curr_clause++;
+        num_clauses++;
+        need_sort = true;
+        return offs;
+    }
 
-        auto *cls = &clauses[(curr_clause)];
-        if (cache->contains(cls)) {
-            cls->deleted = true;
-            adj_deleted++;
-        } else {
-            cache->add(cls);
-            for (auto l : clauses[(curr_clause)].lits) {
-                config.steps--;
-                lit_to_clauses[lit_index(l)].push_back(curr_clause);
+    // Adds the clauses in data[0, n), each ended by 0 but maybe the last,
+    // without a vector per clause. If sorted, the literals of each clause
+    // should be in increasing order and finish_cnf() does not sort them.
+    // That is checked as the literals are copied, and if any clause is out
+    // of order, all are sorted after all.
+    void add_clauses(const int* data, size_t n, bool sorted) {
+        assert(found_header);
+        const int* end = data + n;
+        const size_t zeros = std::count(data, end, 0);
+        const size_t cls = zeros + (n > 0 && end[-1] != 0);
+        ca.reserve(ca.end_offset() + (n - zeros) + cls * Clause::header_words);
+
+        const int* p = data;
+        bool in_order = true;
+        while (p < end) {
+            const int* b = p;
+            for (; p < end && *p != 0; p++) {
+                if ((uint32_t)abs(*p) > num_vars) {
+                    fprintf(stderr, "Error: CNF has a variable that is greater than the number of variables specified\n");
+                    exit(1);
+                }
+                in_order &= p == b || p[-1] <= *p;
             }
+            ca.alloc(b, p - b);
+            curr_clause++;
+            num_clauses++;
+            if (p < end) p++;
         }
-
-        curr_clause++;
-        num_clauses = curr_clause;
+        if (!sorted || !in_order) need_sort = true;
     }
 
+    // Each step is split over config.num_threads, and its result does not
+    // depend on the number of threads.
     void finish_cnf() {
-        delete cache;
-        cache = nullptr;
-        for (size_t i=1; i<=num_vars; i++) {
-            update_adjacency_matrix(i);
+        double my_time = cpuTime();
+        uint32_t threads = config.num_threads;
+        vector<ClOffset> offsets = clause_offsets();
+        if (offsets.size() < threads) threads = 1;
+
+        parallel_for(offsets.size(), threads, [&](uint32_t, size_t begin, size_t end) {
+            for (size_t i = begin; i < end; i++) {
+                Clause* cls = ca.ptr(offsets[i]);
+                if (need_sort) sort(cls->begin(), cls->end());
+                cls->hash_val();
+            }
+        });
+
+        const size_t dups = config.dedup_sort ? dedup_sorted(offsets, threads) : dedup_hashed(offsets, threads);
+        if (dups > 0) {
+            compact();
+            offsets = clause_offsets();
+        }
+        build_occ_lists(offsets, threads);
+
+        if (config.verbosity) {
+            double vm;
+            cout << "c loaded " << num_clauses << " clauses, removed " << dups << " duplicates"
+                << " RSS MB: " << memUsedTotal(vm)/(1024*1024)
+                << " T: " << std::setprecision(2) << std::fixed << (cpuTime() - my_time) << endl;
         }
     }
 
-    void read_cnf(FILE *fin) {
-        char *line = nullptr;
-        size_t len = 0;
+    vector<ClOffset> clause_offsets() const {
+        vector<ClOffset> offsets;
+        offsets.reserve(num_clauses);
+        for (ClOffset offs = 0; offs < ca.end_offset(); offs = ca.next(offs)) {
+            offsets.push_back(offs);
+        }
+        return offsets;
+    }
 
-        assert(cache == nullptr);
-        cache = new ClauseCache;
+    // Marks all but the first of every set of equal clauses deleted, and
+    // returns their number. The clauses are split by hash over the threads,
+    // and each thread sees its share in offset order, so it keeps the same
+    // clause a single thread would.
+    size_t dedup_hashed(const vector<ClOffset>& offsets, uint32_t threads) {
+        vector<vector<vector<ClOffset>>> shares(threads, vector<vector<ClOffset>>(threads));
+        parallel_for(offsets.size(), threads, [&](uint32_t t, size_t begin, size_t end) {
+            for (size_t i = begin; i < end; i++) {
+                // High bits, the tables index by the low ones
+                const uint64_t h = ca.ptr(offsets[i])->hash;
+                shares[t][(h * threads) >> 32].push_back(offsets[i]);
+            }
+        });
+
+        vector<size_t> dups(threads, 0);
+        vector<uint32_t> words(threads, 0);
+        vector<size_t> mem(threads, 0);
+        parallel_for(threads, threads, [&](uint32_t, size_t begin, size_t end) {
+            for (size_t t = begin; t < end; t++) {
+                ClauseCache cache(ca);
+                for (auto& share : shares) {
+                    for (ClOffset offs : share[t]) {
+                        if (cache.insert(offs)) continue;
+                        Clause* cls = ca.ptr(offs);
+                        cls->deleted = true;
+                        words[t] += Clause::header_words + cls->size();
+                        dups[t]++;
+                    }
+                    vector<ClOffset>().swap(share[t]);
+                }
+                mem[t] = cache.mem_used();
+            }
+        });
+
+        size_t total = 0;
+        size_t total_mem = 0;
+        for (uint32_t t = 0; t < threads; t++) {
+            total += dups[t];
+            dead_words += words[t];
+            total_mem += mem[t];
+        }
+        adj_deleted += total;
+        if (config.verbosity)
+            cout << "c duplicate check MB: " << total_mem/(1024*1024) << endl;
+        return total;
+    }
 
-        curr_clause = 0;
-        while (getline2(&line, &len, fin) != -1) {
-            if (len == 0) {
-                continue;
+    // Builds the occurrence lists in two passes over the clauses, counting
+    // the entries of every literal, then writing them. Each thread takes a
+    // range of clauses and writes its entries from its own start position in
+    // every list, computed from the counts, so the lists come out in offset
+    // order and are allocated exactly once.
+    void build_occ_lists(const vector<ClOffset>& offsets, uint32_t threads) {
+        const size_t num_lits = lit_to_clauses.size();
+        vector<vector<uint32_t>> pos(threads);
+        parallel_for(offsets.size(), threads, [&](uint32_t t, size_t begin, size_t end) {
+            auto& count = pos[t];
+            count.assign(num_lits, 0);
+            for (size_t i = begin; i < end; i++) {
+                for (int lit : *ca.ptr(offsets[i])) count[lit_index(lit)]++;
             }
-            if (line[0] == 'c') {
-                continue;
-            } else if (line[0] == 'p') {
-                sscanf(line, "p cnf %lu %lu", &num_vars, &num_clauses);
-                clauses.resize(num_clauses);
-                lit_to_clauses.resize(num_vars * 2);
-                lit_count_adjust.resize(num_vars * 2);
-                adjacency_matrix_width = num_vars * 4;
-                adjacency_matrix.resize(num_vars);
-                found_header = true;
-            } else {
-                if (!found_header) {
-                    fprintf(stderr, "Error: CNF file does not have a header\n");
-                    exit(1);
+        });
+
+        parallel_for(num_lits, threads, [&](uint32_t, size_t begin, size_t end) {
+            for (size_t l = begin; l < end; l++) {
+                uint32_t total = 0;
+                for (auto& p : pos) {
+                    const uint32_t c = p[l];
+                    p[l] = total;
+                    total += c;
                 }
+                assert(lit_to_clauses[l].empty());
+                lit_to_clauses[l].resize(total);
+            }
+        });
+
+        parallel_for(offsets.size(), threads, [&](uint32_t t, size_t begin, size_t end) {
+            auto& p = pos[t];
+            for (size_t i = begin; i < end; i++) {
+                const Clause* cls = ca.ptr(offsets[i]);
+                const uint64_t sig = clause_sig(cls);
+                for (int lit : *cls) {
+                    const uint32_t l = lit_index(lit);
+                    lit_to_clauses[l][p[l]++] = OccEntry{offsets[i], cls->size(), sig};
+                }
+            }
+        });
+        vector<vector<uint32_t>>().swap(pos);
+
+        // Only the sizes need sorting
+        parallel_for(num_lits, threads, [&](uint32_t, size_t begin, size_t end) {
+            for (size_t l = begin; l < end; l++) {
+                std::stable_sort(lit_to_clauses[l].begin(), lit_to_clauses[l].end(),
+                    [](const OccEntry& a, const OccEntry& b) { return a.size < b.size; });
+                occ_sorted[l] = lit_to_clauses[l].size();
+            }
+        });
+    }
 
-                if (curr_clause >= num_clauses && line[0] == 0) {
-                    fprintf(stderr, "Error: CNF file has more clauses than specified in header\n");
-                    exit(1);
+    // The same as dedup_hashed(), for config.dedup_sort. Sorts the offsets
+    // instead of building a hash table, and puts them back in order after.
+    size_t dedup_sorted(vector<ClOffset>& offsets, uint32_t threads) {
+        double my_time = cpuTime();
+        auto less = [&](ClOffset a, ClOffset b) {
+            const Clause* cla = ca.ptr(a);
+            const Clause* clb = ca.ptr(b);
+            if (cla->hash != clb->hash) return cla->hash < clb->hash;
+            if (cla->size() != clb->size()) return cla->size() < clb->size();
+            int c = memcmp(cla->begin(), clb->begin(), cla->size() * sizeof(int));
+            if (c != 0) return c < 0;
+            return a < b;
+        };
+        const size_t n = offsets.size();
+        parallel_for(n, threads, [&](uint32_t, size_t begin, size_t end) {
+            std::sort(offsets.begin() + begin, offsets.begin() + end, less);
+        });
+        for (uint32_t t = 1; t < threads; t++) {
+            std::inplace_merge(offsets.begin(), offsets.begin() + n * t / threads,
+                offsets.begin() + n * (t+1) / threads, less);
+        }
+
+        size_t dups = 0;
+        for (size_t i = 1; i < n; i++) {
+            Clause* cls = ca.ptr(offsets[i]);
+            if (*cls == *ca.ptr(offsets[i-1])) {
+                cls->deleted = true;
+                dead_words += Clause::header_words + cls->size();
+                dups++;
+            }
+        }
+        adj_deleted += dups;
+        std::sort(offsets.begin(), offsets.end());
+
+        if (config.verbosity)
+            cout << "c sort-based dedup removed " << dups << " clauses T: "
+                << std::setprecision(2) << std::fixed << (cpuTime() - my_time) << endl;
+        return dups;
+    }
+
+    static uint64_t clause_sig(const Clause* cls) {
+        uint64_t sig = 0;
+        for (int lit : *cls) sig |= lit_sig(lit);
+        return sig;
+    }
+
+    // Appends to the occurrence list of lit. Clauses added during run_sbva
+    // have the largest offset yet, and occ_sort() puts them in the bucket of
+    // their size when the list is next looked up by size.
+    void occ_add(int lit, ClOffset offs) {
+        const Clause* cls = ca.ptr(offs);
+        lit_to_clauses[lit_index(lit)].push_back(OccEntry{offs, cls->size(), clause_sig(cls)});
+    }
+
+    // Merges the entries appended since the last sort into the sorted part
+    void occ_sort(uint32_t l) {
+        auto& occs = lit_to_clauses[l];
+        if (occ_sorted[l] == occs.size()) return;
+        const auto mid = occs.begin() + occ_sorted[l];
+        std::sort(mid, occs.end());
+        std::inplace_merge(occs.begin(), mid, occs.end());
+        occ_sorted[l] = occs.size();
+    }
+
+    // The bucket of clauses of the given size in the occurrence list of lit
+    std::pair<const OccEntry*, const OccEntry*> occ_bucket(int lit, uint32_t size) {
+        occ_sort(lit_index(lit));
+        const auto& occs = lit_to_clauses[lit_index(lit)];
+        auto range = std::equal_range(occs.data(), occs.data() + occs.size(), OccEntry{0, size, 0},
+            [](const OccEntry& a, const OccEntry& b) { return a.size < b.size; });
+        return range;
+    }
+
+    // The clauses of one chunk of the input, tokenized by tokenize_chunk()
+    struct ParseChunk {
+        vector<int> lits; // each clause ended by a 0
+        const char* error = nullptr; // the first error, nothing after it is read
+        bool stop = false; // found '%', nothing after it counts
+    };
+
+    // The same as the clause part of read_cnf(), without adding the clauses
+    static void tokenize_chunk(const char* begin, const char* end, ParseChunk& out) {
+        Reader in(begin, end);
+        while (true) {
+            in.skip_whitespace();
+            int c = in.peek();
+            if (c == EOF) return;
+            if (c == '%') {
+                out.stop = true;
+                return;
+            }
+            if (c == 'c') {
+                in.skip_line();
+                continue;
+            }
+            if (c == 'p') {
+                out.error = "Error: CNF file has more than one header";
+                return;
+            }
+            int lit = 0;
+            if (!in.parse_int(lit)) {
+                out.error = "Error: CNF file has an invalid literal";
+                return;
+            }
+            out.lits.push_back(lit);
+        }
+    }
+
+    // Start of the line after p, or end
+    static const char* next_line(const char* p, const char* end) {
+        const char* nl = (const char*)memchr(p, '\n', end - p);
+        return nl == nullptr ? end : nl + 1;
+    }
+
+    // Reads the clauses of a memory-mapped input on config.num_threads
+    // threads. The input is taken in rounds of about chunk_max bytes per
+    // thread, so only one round of tokenized literals is held at a time. A
+    // round is split at line starts, which are always between tokens, so
+    // every chunk tokenizes the same as the sequential scan. The chunks are
+    // then added in order, with the same checks. A clause may span chunks,
+    // its start is left in lits.
+    void read_clauses_chunked(Reader& in, vector<int>& lits, size_t hdr_clauses) {
+        const char* pos;
+        const char* end;
+        in.remaining(pos, end);
+        const uint32_t threads = config.num_threads;
+        vector<ParseChunk> chunks(threads);
+        vector<const char*> bounds(threads + 1);
+
+        while (pos < end) {
+            const size_t round = std::min<size_t>(end - pos, chunk_max * threads);
+            const uint32_t num = std::max<size_t>(1, std::min<size_t>(threads, round / chunk_min));
+            bounds[0] = pos;
+            bounds[num] = pos + round == end ? end : next_line(pos + round, end);
+            for (uint32_t t = 1; t < num; t++) {
+                bounds[t] = std::min(bounds[num], next_line(pos + round * t / num, end));
+            }
+
+            parallel_for(num, num, [&](uint32_t, size_t b, size_t e) {
+                for (size_t t = b; t < e; t++) {
+                    chunks[t].lits.clear();
+                    chunks[t].error = nullptr;
+                    chunks[t].stop = false;
+                    tokenize_chunk(bounds[t], bounds[t+1], chunks[t]);
                 }
+            });
 
-                int lit = 0;
-                char *curr = line;
-                while (sscanf(curr, "%d", &lit) > 0) {
-                    if (lit == 0) {
-                        break;
+            for (uint32_t t = 0; t < num; t++) {
+                for (int lit : chunks[t].lits) {
+                    if (lit != 0) {
+                        lits.push_back(lit);
+                        continue;
                     }
-                    if ((uint32_t)abs(lit) > num_vars) {
-                        fprintf(stderr, "Error: CNF file has a variable that is greater than the number of variables specified in the header\n");
+                    if (curr_clause >= hdr_clauses) {
+                        fprintf(stderr, "Error: CNF file has more clauses than specified in header\n");
                         exit(1);
                     }
-                    config.steps--;
-                    clauses[(curr_clause)].lits.push_back(lit);
-                    curr = strchr(curr, ' ');
-                    curr++;
+                    add_cl(lits);
+                    lits.clear();
                 }
+                if (chunks[t].error != nullptr) {
+                    fprintf(stderr, "%s\n", chunks[t].error);
+                    exit(1);
+                }
+                if (chunks[t].stop) return;
+            }
+            pos = bounds[num];
+        }
+    }
 
-                sort(clauses[(curr_clause)].lits.begin(), clauses[(curr_clause)].lits.end());
+    // Reads the binary format of bincnf.h, up to calling finish_cnf(). Clause
+    // hashes in the input are trusted, a wrong one can only hide a duplicate.
+    void read_binary_cnf(Reader& in) {
+        double my_time = cpuTime();
+        if (!in.expect("SBVB")) {
+            fprintf(stderr, "Error: Binary CNF file has a malformed header\n");
+            exit(1);
+        }
+        const int version = in.peek();
+        in.advance();
+        const int flags = in.peek();
+        in.advance();
+        if (version != bincnf_version || flags == EOF || (flags & ~bincnf_hashes) != 0) {
+            fprintf(stderr, "Error: Binary CNF file has unsupported version %d or flags %d\n", version, flags);
+            exit(1);
+        }
+        const bool hashes = flags & bincnf_hashes;
+        uint64_t nvars = 0;
+        uint64_t ncls = 0;
+        if (!in.read_varint(nvars) || !in.read_varint(ncls) || nvars > INT_MAX) {
+            fprintf(stderr, "Error: Binary CNF file has a malformed header\n");
+            exit(1);
+        }
+        init_cnf(nvars);
+
+        vector<int> lits;
+        for (uint64_t i = 0; i < ncls; i++) {
+            uint64_t sz = 0;
+            bool ok = in.read_varint(sz);
+            lits.clear();
+            int64_t prev = 0;
+            bool sorted = true;
+            for (uint64_t j = 0; ok && j < sz; j++) {
+                uint64_t delta = 0;
+                ok = in.read_varint(delta);
+                const int64_t lit = prev + unzigzag(delta);
+                if (ok && (lit == 0 || lit > INT_MAX || lit < -INT_MAX)) {
+                    fprintf(stderr, "Error: Binary CNF file has an invalid literal\n");
+                    exit(1);
+                }
+                sorted &= j == 0 || lit >= prev;
+                prev = lit;
+                lits.push_back(lit);
+            }
+            uint32_t hash = 0;
+            if (ok && hashes) ok = in.read_u32le(hash);
+            if (!ok) {
+                fprintf(stderr, "Error: Binary CNF file is truncated\n");
+                exit(1);
+            }
+            const ClOffset offs = add_cl(lits);
+            if (sorted) ca.ptr(offs)->hash = hash;
+        }
+        if (config.verbosity) {
+            double vm;
+            cout << "c read " << curr_clause << " clauses (binary"
+                << (hashes ? ", hashes" : "") << ") compression: " << compression_name(in.compression())
+                << " RSS MB: " << memUsedTotal(vm)/(1024*1024)
+                << " T: " << std::setprecision(2) << std::fixed << (cpuTime() - my_time) << endl;
+        }
+        finish_cnf();
+    }
 
-                auto *cls = &clauses[(curr_clause)];
-                if (cache->contains(cls)) {
-                    cls->deleted = true;
-                    adj_deleted++;
-                } else {
-                    cache->add(cls);
-                    for (auto l : clauses[(curr_clause)].lits) {
-                        config.steps--;
-                        lit_to_clauses[lit_index(l)].push_back(curr_clause);
-                    }
+    void read_cnf(FILE *fin) {
+        double my_time = cpuTime();
+        Reader in(fin);
+        // Not the start of any valid DIMACS file
+        if (in.peek() == bincnf_magic[0]) {
+            read_binary_cnf(in);
+            return;
+        }
+        vector<int> lits;
+        size_t hdr_clauses = 0;
+
+        while (true) {
+            in.skip_whitespace();
+            int c = in.peek();
+            if (c == EOF || c == '%') {
+                // '%' terminates the formula in some old benchmark sets
+                break;
+            }
+            if (c == 'c') {
+                in.skip_line();
+                continue;
+            }
+            if (c == 'p') {
+                int nvars = 0;
+                int ncls = 0;
+                in.advance();
+                in.skip_whitespace();
+                bool ok = in.expect("cnf");
+                in.skip_whitespace();
+                ok = ok && in.parse_int(nvars);
+                in.skip_whitespace();
+                ok = ok && in.parse_int(ncls);
+                if (!ok || nvars < 0 || ncls < 0) {
+                    fprintf(stderr, "Error: CNF file has a malformed header\n");
+                    exit(1);
+                }
+                if (found_header) {
+                    fprintf(stderr, "Error: CNF file has more than one header\n");
+                    exit(1);
+                }
+                hdr_clauses = ncls;
+                init_cnf(nvars);
+                if (config.num_threads > 1 && in.is_mmapped()) {
+                    read_clauses_chunked(in, lits, hdr_clauses);
+                    break;
                 }
+                continue;
+            }
+
+            if (!found_header) {
+                fprintf(stderr, "Error: CNF file does not have a header\n");
+                exit(1);
+            }
+
+            // Clauses are whitespace-separated and 0-terminated, so they may
+            // span several lines or share one.
+            int lit = 0;
+            if (!in.parse_int(lit)) {
+                fprintf(stderr, "Error: CNF file has an invalid literal\n");
+                exit(1);
+            }
+            if (lit != 0) {
+                lits.push_back(lit);
+                continue;
+            }
+            if (curr_clause >= hdr_clauses) {
+                fprintf(stderr, "Error: CNF file has more clauses than specified in header\n");
+                exit(1);
+            }
+            add_cl(lits);
+            lits.clear();
+        }
 
-                curr_clause++;
+        if (!found_header) {
+            fprintf(stderr, "Error: CNF file does not have a header\n");
+            exit(1);
+        }
+        // Be lenient with a missing 0 after the last clause
+        if (!lits.empty()) {
+            if (curr_clause >= hdr_clauses) {
+                fprintf(stderr, "Error: CNF file has more clauses than specified in header\n");
+                exit(1);
             }
+            add_cl(lits);
+        }
+        if (config.verbosity) {
+            double vm;
+            cout << "c read " << curr_clause << " clauses"
+                << (in.is_mmapped() ? " (mmap)" : "")
+                << " compression: " << compression_name(in.compression()) << " threads: " << config.num_threads
+                << " RSS MB: " << memUsedTotal(vm)/(1024*1024)
+                << " T: " << std::setprecision(2) << std::fixed << (cpuTime() - my_time) << endl;
         }
-        free(line);
-        delete cache;
-        cache = nullptr;
+        finish_cnf();
+    }
 
-        for (size_t i=1; i<=num_vars; i++) {
-            update_adjacency_matrix(i);
+    // Keeps the rows that are already built exact when a clause is added
+    // (delta 1) or removed (delta -1). Rows that are not built yet are left
+    // alone, they will see the current clauses when they are built. Every
+    // variable of the clause is stamped with the current adj_version, which
+    // invalidates the cached tie-break scores that depend on it.
+    void adjacency_clause_delta(const Clause* cls, int delta) {
+        for (int u : *cls) {
+            var_version[sparsevec_lit_idx(u)] = adj_version;
+            auto& row = adjacency_matrix[sparsevec_lit_idx(u)];
+            if (!row.built) continue;
+            for (int w : *cls) {
+                config.steps--;
+                row.add(sparsevec_lit_idx(w), delta);
+            }
+            if (row.has_zeros) adj_touched.push_back(sparsevec_lit_idx(u));
         }
     }
 
+    void adjacency_finish_delta() {
+        for (uint32_t idx : adj_touched) adjacency_matrix[idx].remove_zeros();
+        adj_touched.clear();
+    }
+
+    // Rows are only needed for tie-breaking, so they are built on first use
     void update_adjacency_matrix(int lit) {
         int abslit = std::abs(lit);
-        if (adjacency_matrix[sparsevec_lit_idx(abslit)].nonZeros() > 0) {
+        if (adjacency_matrix[sparsevec_lit_idx(abslit)].built) {
             // use cached version
             return;
         }
-        Eigen::SparseVector<int> vec(adjacency_matrix_width);
+        adj_tmp.clear();
 
-        for (int cid : lit_to_clauses[lit_index(abslit)]) {
+        for (const auto& occ : lit_to_clauses[lit_index(abslit)]) {
             config.steps--;
-            Clause *cls = &clauses[cid];
+            ClOffset offs = occ.offs;
+            const Clause *cls = ca.ptr(offs);
             if (cls->deleted) continue;
-            for (int v : cls->lits) {
-                vec.coeffRef(sparsevec_lit_idx(v)) += 1;
+            for (int v : *cls) {
+                adj_tmp.push_back(sparsevec_lit_idx(v));
             }
         }
 
-        for (int cid : lit_to_clauses[lit_index(-abslit)]) {
+        for (const auto& occ : lit_to_clauses[lit_index(-abslit)]) {
             config.steps--;
-            Clause *cls = &clauses[cid];
+            ClOffset offs = occ.offs;
+            const Clause *cls = ca.ptr(offs);
             if (cls->deleted) continue;
-            for (int v : cls->lits) {
-                vec.coeffRef(sparsevec_lit_idx(v)) += 1;
+            for (int v : *cls) {
+                adj_tmp.push_back(sparsevec_lit_idx(v));
             }
         }
 
-        adjacency_matrix[sparsevec_lit_idx(abslit)] = vec;
+        adjacency_matrix[sparsevec_lit_idx(abslit)].build(adj_tmp);
     }
 
-    int tiebreaking_heuristic(int lit1, int lit2) {
-        if (tmp_heuristic_cache_full.find(sparsevec_lit_idx(lit2)) != tmp_heuristic_cache_full.end()) {
-            return tmp_heuristic_cache_full[sparsevec_lit_idx(lit2)];
-        }
-        int abs1 = std::abs(lit1);
-        int abs2 = std::abs(lit2);
+    // Scores every tied literal t against lit1 with the three-hop heuristic
+    //   h(t) = sum_{w in row(t)} row(t)[w] * dot(row(w), row(lit1))
+    // The neighbour terms dot(row(w), row(lit1)) do not depend on t, so they
+    // are computed once per outer iteration of run_sbva, as one sparse
+    // matrix-vector product against row(lit1) scattered into a dense array,
+    // and shared by all ties. Large batches are spread over config.num_threads.
+    //
+    // h(t) = row(t)^T M row(lit1) for the symmetric adjacency matrix M, so it
+    // only depends on the rows of lit1 and t, and on the rows of the variables
+    // in either one of those (tie_cache_valid() checks row(idx2)). A score
+    // from an earlier iteration, also one computed with the roles of the two
+    // swapped, is reused from tie_cache as long as none of these variables
+    // were in a clause added or removed since.
+    void tiebreaking_heuristic(int lit1, const vector<int>& ties, vector<int>& scores) {
+        const uint32_t idx1 = sparsevec_lit_idx(lit1);
         update_adjacency_matrix(lit1);
-        update_adjacency_matrix(lit2);
+        if (tie_var != idx1) {
+            // New outer iteration
+            tie_epoch++;
+            if (tie_epoch == 0) {
+                std::fill(tie_nb_stamp.begin(), tie_nb_stamp.end(), 0);
+                std::fill(tie_score_stamp.begin(), tie_score_stamp.end(), 0);
+                tie_epoch = 1;
+            }
+            tie_var = idx1;
+            for (uint32_t x : tie_dense_idxs) tie_dense[x] = 0;
+            tie_dense_idxs.clear();
+        }
+        if (tie_dense.size() < num_vars) {
+            tie_dense.resize(num_vars, 0);
+            tie_nb_stamp.resize(num_vars, 0);
+            tie_nb_dot.resize(num_vars, 0);
+            tie_score_stamp.resize(num_vars, 0);
+            tie_score.resize(num_vars, 0);
+        }
 
-        auto& vec1 = adjacency_matrix[sparsevec_lit_idx(abs1)];
-        auto& vec2 = adjacency_matrix[sparsevec_lit_idx(abs2)];
+        // Look up the cache first, the rows of cached ties are built already
+        tie_todo.clear();
+        for (int t : ties) {
+            const uint32_t idx2 = sparsevec_lit_idx(t);
+            if (tie_score_stamp[idx2] == tie_epoch) continue;
+            tie_score_stamp[idx2] = tie_epoch;
+
+            const auto& c = tie_cache.slot(idx1, idx2);
+            if (c.matches(idx1, idx2) && tie_cache_valid(c)) {
+                tie_cache.hits++;
+                tie_score[idx2] = c.score;
+                continue;
+            }
+            tie_cache.misses++;
+            tie_todo.push_back(idx2);
+        }
+        if (tie_todo.empty()) {
+            scores.clear();
+            for (int t : ties) scores.push_back(tie_score[sparsevec_lit_idx(t)]);
+            return;
+        }
 
-        int total_count = 0;
-        for (int *var_ptr = vec2.innerIndexPtr(); var_ptr < vec2.innerIndexPtr() + vec2.nonZeros(); var_ptr++) {
+        // Make sure all rows are built, this part modifies shared state
+        if (tie_dense_idxs.empty()) {
+            for (const auto& e : adjacency_matrix[idx1].entries) {
+                tie_dense[e.idx] = e.count;
+                tie_dense_idxs.push_back(e.idx);
+            }
+        }
+        tie_nb_todo.clear();
+        size_t work = 0;
+        for (uint32_t idx2 : tie_todo) {
+            update_adjacency_matrix(sparcevec_lit_for_idx(idx2));
+            for (const auto& e : adjacency_matrix[idx2].entries) {
+                config.steps--;
+                if (tie_nb_stamp[e.idx] == tie_epoch) continue;
+                tie_nb_stamp[e.idx] = tie_epoch;
+                update_adjacency_matrix(sparcevec_lit_for_idx(e.idx));
+                tie_nb_todo.push_back(e.idx);
+                work += adjacency_matrix[e.idx].nonZeros();
+            }
+        }
+
+        // Neighbour dot products, then the tie scores. Rows are read-only
+        // here and every item writes its own slot.
+        const uint32_t threads = work > tie_parallel_work ? config.num_threads : 1;
+        parallel_for(tie_nb_todo.size(), threads, [&](uint32_t, size_t begin, size_t end) {
+            for (size_t i = begin; i < end; i++) {
+                const uint32_t w = tie_nb_todo[i];
+                int dot = 0;
+                for (const auto& e : adjacency_matrix[w].entries) {
+                    dot += e.count * tie_dense[e.idx];
+                }
+                tie_nb_dot[w] = dot;
+            }
+        });
+        parallel_for(tie_todo.size(), threads, [&](uint32_t, size_t begin, size_t end) {
+            for (size_t i = begin; i < end; i++) {
+                const uint32_t idx2 = tie_todo[i];
+                int total_count = 0;
+                for (const auto& e : adjacency_matrix[idx2].entries) {
+                    total_count += e.count * tie_nb_dot[e.idx];
+                }
+                tie_score[idx2] = total_count;
+            }
+        });
+        for (uint32_t idx2 : tie_todo) {
+            auto& c = tie_cache.slot(idx1, idx2);
+            c.idx1 = std::min(idx1, idx2);
+            c.idx2 = std::max(idx1, idx2);
+            c.version = adj_version;
+            c.score = tie_score[idx2];
+        }
+
+        scores.clear();
+        for (int t : ties) scores.push_back(tie_score[sparsevec_lit_idx(t)]);
+    }
+
+    bool tie_cache_valid(const TieCache::Entry& c) {
+        if (var_version[c.idx1] > c.version || var_version[c.idx2] > c.version) {
+            return false;
+        }
+        for (const auto& e : adjacency_matrix[c.idx2].entries) {
             config.steps--;
-            int var = sparcevec_lit_for_idx(*var_ptr);
-            int count = vec2.coeffRef(sparsevec_lit_idx(var));
-            update_adjacency_matrix(var);
-            auto& vec3 = adjacency_matrix[sparsevec_lit_idx(var)];
-            total_count += count * vec3.dot(vec1);
+            if (var_version[e.idx] > c.version) return false;
         }
-        tmp_heuristic_cache_full[sparsevec_lit_idx(lit2)] = total_count;
-        return total_count;
+        return true;
     }
 
-    auto to_cnf(FILE *fout) {
-        fprintf(fout, "p cnf %lu %lu\n", num_vars, num_clauses - adj_deleted);
-        for (size_t i = 0; i < num_clauses; i++) {
-            if (clauses[(i)].deleted) {
-                continue;
+    // Drops the deleted clauses from the arena and the occurrence lists, and
+    // renumbers the live ones. Clause order, hence output order, is kept.
+    // Afterwards every occurrence list is exact, so lit_count_adjust is zero.
+    // Only called after loading, or between two outer iterations of run_sbva,
+    // when no clause offsets are held anywhere else. The partner index has to
+    // be rebuilt after.
+    void compact() {
+        double my_time = cpuTime();
+        const size_t words_before = ca.end_offset();
+        const ClOffset live_words = ca.plan_compact();
+
+        for (uint32_t l = 0; l < lit_to_clauses.size(); l++) {
+            auto& occs = lit_to_clauses[l];
+            config.steps -= occs.size();
+            occ_sort(l);
+            size_t j = 0;
+            for (const auto& occ : occs) {
+                if (ca.ptr(occ.offs)->deleted) continue;
+                occs[j] = occ;
+                occs[j].offs = ca.relocated(occ.offs);
+                j++;
             }
-            for (int lit : clauses[(i)].lits) {
-                fprintf(fout, "%d ", lit);
+            occs.resize(j);
+            occ_sorted[l] = j;
+        }
+        ca.finish_compact();
+        config.steps -= words_before;
+
+        std::fill(lit_count_adjust.begin(), lit_count_adjust.end(), 0);
+        num_clauses -= adj_deleted;
+        adj_deleted = 0;
+        dead_words = 0;
+
+        if (config.verbosity)
+            cout << "c compacted clauses, words: " << words_before << " -> " << live_words
+                << " T: " << std::setprecision(2) << std::fixed << (cpuTime() - my_time) << endl;
+    }
+
+    // Writes the format of bincnf.h
+    void to_binary_cnf(Writer& out, bool hashes) {
+        out.put(bincnf_magic, 4);
+        const char hdr[2] = {(char)bincnf_version, (char)(hashes ? bincnf_hashes : 0)};
+        out.put(hdr, 2);
+        out.put_varint(num_vars);
+        out.put_varint(num_clauses - adj_deleted);
+        for (ClOffset offs = 0; offs < ca.end_offset(); offs = ca.next(offs)) {
+            const Clause* cls = ca.ptr(offs);
+            if (cls->deleted) continue;
+            out.put_varint(cls->size());
+            int64_t prev = 0;
+            for (int lit : *cls) {
+                out.put_varint(zigzag(lit - prev));
+                prev = lit;
             }
-            fprintf(fout, "0\n");
+            if (hashes) out.put_u32le(cls->hash_val());
+        }
+        out.finish();
+    }
+
+    // Most bytes format_clause() writes for a clause of sz literals
+    static size_t max_clause_bytes(size_t sz) {
+        return sz * 12 + 2;
+    }
+
+    static char* format_clause(char* p, const int* lits, size_t sz) {
+        for (size_t i = 0; i < sz; i++) {
+            p += format_int(p, lits[i]);
+            *p++ = ' ';
         }
+        memcpy(p, "0\n", 2);
+        return p + 2;
+    }
+
+    // Writes the items of one round of write_items(), in order. The items are
+    // split over the threads, each formats its range into its own buffer.
+    template<class Bound, class Format>
+    void write_round(Writer& out, const vector<size_t>& items, size_t bytes, Bound bound, Format format) {
+        const uint32_t threads = bytes < write_parallel_bytes ? 1 : config.num_threads;
+        write_bufs.resize(config.num_threads);
+        for (auto& b : write_bufs) b.clear();
+        parallel_for(items.size(), threads, [&](uint32_t t, size_t begin, size_t end) {
+            size_t sz = 0;
+            for (size_t i = begin; i < end; i++) sz += bound(items[i]);
+            auto& buf = write_bufs[t];
+            buf.resize(sz);
+            char* p = buf.data();
+            for (size_t i = begin; i < end; i++) p = format(p, items[i]);
+            buf.resize(p - buf.data());
+        });
+        for (const auto& b : write_bufs) out.put(b.data(), b.size());
+    }
+
+    // Writes every item next() returns, until it returns false, formatting
+    // them in rounds of about write_round_bytes per thread. bound(item) is
+    // the most bytes format(p, item) writes at p, it returns the end.
+    template<class Next, class Bound, class Format>
+    void write_items(Writer& out, Next next, Bound bound, Format format) {
+        vector<size_t> items;
+        size_t bytes = 0;
+        size_t item;
+        while (next(item)) {
+            items.push_back(item);
+            bytes += bound(item);
+            if (bytes >= write_round_bytes * config.num_threads) {
+                write_round(out, items, bytes, bound, format);
+                items.clear();
+                bytes = 0;
+            }
+        }
+        write_round(out, items, bytes, bound, format);
+        vector<vector<char>>().swap(write_bufs);
+    }
+
+    auto to_cnf(FILE *fout, Compression comp, CnfFormat fmt) {
+        Writer out(fout, comp);
+        if (fmt != CnfFormat::Dimacs) {
+            to_binary_cnf(out, fmt == CnfFormat::BinaryHashes);
+            return std::make_pair(num_vars, num_clauses-adj_deleted);
+        }
+        out.put("p cnf ");
+        out.put_int(num_vars);
+        out.put(" ");
+        out.put_int(num_clauses - adj_deleted);
+        out.put("\n");
+        ClOffset offs = 0;
+        write_items(out,
+            [&](size_t& item) {
+                for (; offs < ca.end_offset(); offs = ca.next(offs)) {
+                    if (ca.ptr(offs)->deleted) continue;
+                    item = offs;
+                    offs = ca.next(offs);
+                    return true;
+                }
+                return false;
+            },
+            [&](size_t item) { return max_clause_bytes(ca.ptr(item)->size()); },
+            [&](char* p, size_t item) {
+                const Clause* cls = ca.ptr(item);
+                return format_clause(p, cls->begin(), cls->size());
+            });
+        out.finish();
         return std::make_pair(num_vars, num_clauses-adj_deleted);
     }
 
     vector<int> get_cnf(uint32_t& ret_num_vars, uint32_t& ret_num_cls) {
-        vector<int> ret;
         ret_num_cls = num_clauses - adj_deleted;
         ret_num_vars = num_vars;
-        for (size_t i = 0; i < num_clauses; i++) {
-            if (clauses[(i)].deleted) continue;
-            for (int lit : clauses[(i)].lits) {
-                ret.push_back(lit);
-            }
-            ret.push_back(0);
+        vector<int> ret(export_size());
+        export_cnf(ret.data(), ret.size());
+        return ret;
+    }
+
+    uint32_t get_num_vars() const { return num_vars; }
+    uint32_t get_num_clauses() const { return num_clauses - adj_deleted; }
+
+    // Literals of the live clauses, plus one for the 0 after each
+    size_t export_size() const {
+        size_t ret = 0;
+        for (ClOffset offs = 0; offs < ca.end_offset(); offs = ca.next(offs)) {
+            const Clause* cls = ca.ptr(offs);
+            if (!cls->deleted) ret += cls->size() + 1;
         }
         return ret;
     }
 
-    void to_proof(FILE *fproof) {
-        for (const auto & clause : proof) {
-            if (!clause.is_addition) {
-                fprintf(fproof, "d ");
+    size_t export_cnf(int* buf, size_t cap) const {
+        const size_t sz = export_size();
+        if (cap < sz) return 0;
+        int* p = buf;
+        for (ClOffset offs = 0; offs < ca.end_offset(); offs = ca.next(offs)) {
+            const Clause* cls = ca.ptr(offs);
+            if (cls->deleted) continue;
+            if (cls->size() > 0) memcpy(p, cls->begin(), cls->size() * sizeof(int));
+            p += cls->size();
+            *p++ = 0;
+        }
+        return sz;
+    }
+
+    // First live clause at offs or after it, ca.end_offset() if there is
+    // none. This is what SBVA::ClauseIterator walks.
+    ClOffset live_at(ClOffset offs, const int*& lits, uint32_t& sz) const {
+        while (offs < ca.end_offset() && ca.ptr(offs)->deleted) offs = ca.next(offs);
+        if (offs < ca.end_offset()) {
+            lits = ca.ptr(offs)->begin();
+            sz = ca.ptr(offs)->size();
+        }
+        return offs;
+    }
+
+    ClOffset next_offset(ClOffset offs) const { return ca.next(offs); }
+    ClOffset end_offset() const { return ca.end_offset(); }
+
+    // Writes the proof to fproof as it is made, instead of to the temporary
+    // file of proof_line()
+    void set_proof_output(FILE *fproof, Compression comp, ProofFormat fmt) {
+        if (proof_out != nullptr) {
+            fprintf(stderr, "Error: The proof output has to be set before the proof is started\n");
+            exit(1);
+        }
+        proof_out = new Writer(fproof, comp);
+        proof_fmt = fmt;
+        proof_direct = true;
+    }
+
+    // Appends one line to the proof. Unless set_proof_output() was called,
+    // the proof is written to a temporary file in binary DRAT as it is made,
+    // so it never takes more memory than the buffer.
+    void proof_line(const int* lits, size_t sz, bool deletion) {
+        if (proof_out == nullptr) {
+            proof_spill = tmpfile();
+            if (proof_spill == nullptr) {
+                fprintf(stderr, "Error: Could not create temporary file for the proof\n");
+                exit(1);
+            }
+            proof_out = new Writer(proof_spill, Compression::None);
+        }
+        if (proof_fmt == ProofFormat::Drat) {
+            if (deletion) proof_out->put("d ", 2);
+            for (size_t i = 0; i < sz; i++) {
+                proof_out->put_int(lits[i]);
+                proof_out->put(" ", 1);
+            }
+            proof_out->put("0\n", 2);
+            return;
+        }
+        proof_out->put(deletion ? "d" : "a", 1);
+        for (size_t i = 0; i < sz; i++) {
+            proof_out->put_varint(drat_lit(lits[i]));
+        }
+        proof_out->put("\0", 1);
+    }
+
+    // Ends the proof written to the output given to set_proof_output()
+    void finish_proof() {
+        if (proof_direct) proof_out->finish();
+    }
+
+    // Copies the proof so far from the temporary file, binary DRAT as it is,
+    // text DRAT by decoding it
+    void to_proof(FILE *fproof, Compression comp, ProofFormat fmt) {
+        if (proof_direct) {
+            fprintf(stderr, "Error: The proof was written to the proof output already\n");
+            exit(1);
+        }
+        Writer out(fproof, comp);
+        if (proof_out != nullptr) {
+            proof_out->flush();
+            rewind(proof_spill);
+            if (fmt == ProofFormat::BinaryDrat) {
+                vector<char> buf(1U << 20);
+                size_t got;
+                while ((got = fread(buf.data(), 1, buf.size(), proof_spill)) > 0) {
+                    out.put(buf.data(), got);
+                }
+            } else {
+                binary_to_text_drat(out);
+            }
+            if (ferror(proof_spill)) {
+                fprintf(stderr, "Error: Could not read back the proof\n");
+                exit(1);
             }
-            for (int lit : clause.lits) {
-                fprintf(fproof, "%d ", lit);
+            fseek(proof_spill, 0, SEEK_END);
+        }
+        out.finish();
+    }
+
+    void binary_to_text_drat(Writer& out) {
+        Reader in(proof_spill);
+        int c;
+        while ((c = in.peek()) != EOF) {
+            in.advance();
+            if (c == 'd') out.put("d ", 2);
+            uint64_t v;
+            while (in.read_varint(v) && v != 0) {
+                out.put_int(drat_unlit(v));
+                out.put(" ", 1);
             }
-            fprintf(fproof, "0\n");
+            out.put("0\n", 2);
         }
     }
 
-    int least_frequent_not(Clause *clause, int var) {
+    // The literal of clause, other than var, whose occurrence list has the
+    // fewest clauses of the same size as clause
+    int least_frequent_not(const Clause *clause, int var) {
         int lmin = 0;
         int lmin_count = 0;
-        for (auto lit : clause->lits) {
+        for (auto lit : *clause) {
             if (lit == var) {
                 continue;
             }
-            int count = lit_to_clauses[lit_index(lit)].size() + lit_count_adjust[lit_index(lit)];
+            config.steps--;
+            auto bucket = occ_bucket(lit, clause->size());
+            int count = bucket.second - bucket.first;
             if (lmin == 0 || count < lmin_count) {
                 lmin = lit;
                 lmin_count = count;
@@ -377,57 +1478,102 @@ public:
         return lmin;
     }
 
+    int any_lit_not(const Clause *clause, int var) {
+        for (auto lit : *clause) {
+            if (lit != var) return lit;
+        }
+        return 0;
+    }
+
     int real_lit_count(int lit) {
         return lit_to_clauses[lit_index(lit)].size() + lit_count_adjust[lit_index(lit)];
     }
 
     // Performs partial clause difference between clause and other, storing the result in diff.
-    // Only the first max_diff literals are stored in diff.
+    // Stops after max_diff+1 literals, enough to tell that the difference is too large.
     // Requires that clause and other are sorted.
-    void clause_sub(Clause *clause, Clause *other, vector<int>& diff, uint32_t max_diff) {
-        diff.resize(0);
-        size_t idx_a = 0;
-        size_t idx_b = 0;
+    void clause_sub(const Clause *clause, const Clause *other, vector<int>& diff, uint32_t max_diff) {
+        config.steps -= clause->size();
+        diff.resize(max_diff + 1);
+        diff.resize(clause_diff(clause->begin(), clause->size(),
+            other->begin(), other->size(), diff.data(), max_diff + 1));
+    }
 
-        while (idx_a < clause->lits.size() && idx_b < other->lits.size() && diff.size() <= max_diff) {
+    // Checks that clause \ {lit} == other \ {other_lit}, both sorted
+    bool same_except(const Clause *clause, int lit, const Clause *other, int other_lit) {
+        if (clause->size() != other->size()) return false;
+        const int* a = clause->begin();
+        const int* b = other->begin();
+        while (true) {
             config.steps--;
-            if (clause->lits[idx_a] == other->lits[idx_b]) {
-                idx_a++;
-                idx_b++;
-            } else if (clause->lits[idx_a] < other->lits[idx_b]) {
-                diff.push_back(clause->lits[idx_a]);
-                idx_a++;
-            } else {
-                idx_b++;
-            }
+            if (a != clause->end() && *a == lit) a++;
+            if (b != other->end() && *b == other_lit) b++;
+            if (a == clause->end() || b == other->end()) break;
+            if (*a++ != *b++) return false;
         }
+        return a == clause->end() && b == other->end();
+    }
+
+    uint64_t clause_zhash(const Clause* cls) const {
+        uint64_t h = 0;
+        for (int lit : *cls) h += zobrist_lit(lit);
+        return h;
+    }
+
+    void partner_index_add(ClOffset offs) {
+        if (!config.partner_index) return;
+        const Clause* cls = ca.ptr(offs);
+        const uint64_t h = clause_zhash(cls);
+        for (int lit : *cls) {
+            partners.add(h - zobrist_lit(lit), offs, lit);
+        }
+    }
 
-        while (idx_a < clause->lits.size() && diff.size() <= max_diff) {
-            diff.push_back(clause->lits[idx_a]);
-            idx_a++;
+    void partner_index_remove(ClOffset offs) {
+        if (!config.partner_index) return;
+        const Clause* cls = ca.ptr(offs);
+        const uint64_t h = clause_zhash(cls);
+        for (int lit : *cls) {
+            partners.remove(h - zobrist_lit(lit), offs, lit);
         }
     }
 
+    void build_partner_index() {
+        partners.clear();
+        if (!config.partner_index) return;
+        double my_time = cpuTime();
+        size_t num_lits = 0;
+        for (const auto& occ : lit_to_clauses) num_lits += occ.size();
+        partners.reserve(num_lits);
+        for (ClOffset offs = 0; offs < ca.end_offset(); offs = ca.next(offs)) {
+            if (ca.ptr(offs)->deleted) continue;
+            partner_index_add(offs);
+        }
+        if (config.verbosity)
+            cout << "c built partner index, entries: " << partners.size()
+                << " MB: " << partners.mem_used()/(1024*1024)
+                << " T: " << std::setprecision(2) << std::fixed << (cpuTime() - my_time) << endl;
+    }
+
     void run_sbva(SBVA::Tiebreak tiebreak_mode) {
-        struct PairOp {
-            bool operator()(const pair<int, int> &a, const pair<int, int> &b) {
-                return a.first < b.first;
-            }
-        };
+        build_partner_index();
 
-        // The priority queue keeps track of all the literals to evaluate for replacements.
-        // Each entry is the pair (num_clauses, lit)
-        priority_queue<pair<int,int>, vector< pair<int,int> >, PairOp> pq;
+        // The priority queue keeps track of all the literals to evaluate for replacements,
+        // keyed by their number of clauses.
+        Heap pq;
+        pq.reserve(num_vars*2);
+        // Kept across iterations, see where the priorities are updated
+        unordered_set<int> update_order;
 
         // Add all of the variables from the original formula to the priority queue.
         for (size_t i = 1; i <= num_vars; i++) {
-            pq.push(make_pair(real_lit_count(i), i));
-            pq.push(make_pair(real_lit_count(-i), -i));
+            pq.push(real_lit_count(i), i);
+            pq.push(real_lit_count(-i), -i);
         }
 
         vector<int> matched_lits;
-        vector<int>* matched_clauses(new vector<int>());
-        vector<int> *matched_clauses_swap(new vector<int>());
+        vector<ClOffset>* matched_clauses(new vector<ClOffset>());
+        vector<ClOffset> *matched_clauses_swap(new vector<ClOffset>());
         vector<int> *matched_clauses_id( new vector<int>());
         vector<int> *matched_clauses_id_swap(new vector<int>());
         matched_lits.reserve(10000);
@@ -437,11 +1583,17 @@ public:
         matched_clauses_id_swap->reserve(10000);
 
         // Track the index of the matched clauses from every literal that is added to matched_lits.
-        vector< tuple<int, int> > clauses_to_remove;
+        vector< tuple<ClOffset, int> > clauses_to_remove;
 
         // Used for computing clause differences
         vector<int> diff;
 
+        // Literals of the clause being added
+        vector<int> new_lits;
+
+        // Heuristic value of each tie
+        vector<int> tie_scores;
+
         // Keep track of the matrix of swaps that we can perform.
         // Each entry is of the form (literal, <clause index>, <index in matched_clauses>)
         //
@@ -477,13 +1629,8 @@ public:
         //              (B v E)  (B v F)  (B v H)
         //              (C v E)  (C v F)  (C v H)
         //
-        vector< tuple<int, int, int> > matched_entries;
-
-        // Keep a list of the literals that are matched so we can sort and count later.
-        vector<int> matched_entries_lits;
-
-        // Used for priority queue updates.
-        unordered_set<int> lits_to_update;
+        vector< tuple<int, ClOffset, int> > matched_entries;
+        ws.grow(num_vars*2);
 
         // Track number of replacements (new auxiliary variables).
         size_t num_replacements = 0;
@@ -495,11 +1642,7 @@ public:
                 if (config.verbosity)
                     cout << "c stopping SBVA due to timeout. time remainK: "
                         << std::setprecision(2) << std::fixed << config.steps/1000.0 << endl;
-                delete matched_clauses;
-                delete matched_clauses_swap;
-                delete matched_clauses_id;
-                delete matched_clauses_id_swap;
-                return;
+                break;
             }
             if (config.verbosity >= 2)
                 cout << "c time remainK: "
@@ -510,26 +1653,23 @@ public:
                 if (config.verbosity) {
                     cout << "Hit replacement limit (" << config.max_replacements << ")" << endl;
                 }
-                delete matched_clauses;
-                delete matched_clauses_swap;
-                delete matched_clauses_id;
-                delete matched_clauses_id_swap;
-                return;
+                break;
             }
 
             matched_lits.clear();
             matched_clauses->clear();
             matched_clauses_id->clear();
             clauses_to_remove.clear();
-            tmp_heuristic_cache_full.clear();
+            ws.new_iteration();
+            tie_var = std::numeric_limits<uint32_t>::max();
 
             // Get the next literal to evaluate.
-            pair<int, int> p = pq.top();
-            pq.pop();
-
-            int var = p.second;
-            int num_matched = p.first;
+            int num_matched = pq.top_key();
+            int var = pq.pop();
 
+            // The count is out of date if the literal was pushed again since,
+            // or clauses were added without re-queueing it (model counting
+            // clause), skip it then
             if (num_matched == 0 || num_matched != real_lit_count(var)) {
                 continue;
             }
@@ -540,22 +1680,27 @@ public:
 
             // Mlit := { l }
             matched_lits.push_back(var);
+            ws.set_matched(var);
 
-            // Mcls := F[l]
+            // Mcls := F[l], in clause order
+            mcls_tmp.clear();
             for (size_t i = 0; i < lit_to_clauses[lit_index(var)].size(); i++) {
                 config.steps--;
-                int clause_idx = lit_to_clauses[lit_index(var)][i];
-                if (!clauses[(clause_idx)].deleted) {
-                    matched_clauses->push_back(clause_idx);
-                    matched_clauses_id->push_back(i);
-                    clauses_to_remove.push_back(make_tuple(clause_idx, i));
+                ClOffset clause_idx = lit_to_clauses[lit_index(var)][i].offs;
+                if (!ca.ptr(clause_idx)->deleted) {
+                    mcls_tmp.push_back(make_pair(clause_idx, (int)i));
                 }
             }
+            std::sort(mcls_tmp.begin(), mcls_tmp.end());
+            for (const auto& p : mcls_tmp) {
+                matched_clauses->push_back(p.first);
+                matched_clauses_id->push_back(p.second);
+                clauses_to_remove.push_back(make_tuple(p.first, p.second));
+            }
 
             while (1) {
                 // P = {}
                 matched_entries.clear();
-                matched_entries_lits.clear();
 
                 if (config.verbosity) {
                     cout << "Iteration, Mlit: ";
@@ -568,30 +1713,74 @@ public:
                 // foreach C in Mcls
                 for (size_t i = 0; i < matched_clauses->size(); i++) {
                     config.steps--;
-                    int clause_idx = (*matched_clauses)[(i)];
+                    ClOffset clause_idx = (*matched_clauses)[(i)];
                     int clause_id = (*matched_clauses_id)[(i)];
-                    auto *clause = &clauses[(clause_idx)];
+                    const Clause *clause = ca.ptr(clause_idx);
 
                     if (config.verbosity >= 3) {
                         cout << "  Clause " << clause_idx << " (" << clause_id << "): ";
                         clause->print();
                     }
 
-                    // let lmin in (C \ {l}) be least occuring in F
-                    int lmin = least_frequent_not(clause, var);
+                    // let lmin in (C \ {l}) be least occuring in F. The index
+                    // lookup does not need lmin, only that C \ {l} is not empty.
+                    int lmin = config.partner_index ? any_lit_not(clause, var)
+                        : least_frequent_not(clause, var);
                     if (lmin == 0) {
                         continue;
                     }
 
-                    // foreach D in F[lmin]
-                    for (auto other_idx : lit_to_clauses[lit_index(lmin)]) {
+                    // D is a partner of C, with D \ C = {lit}
+                    auto add_partner = [&](ClOffset other_idx, int lit) {
+                        // if lit not in Mlit then
+                        if (!ws.is_matched(lit)) {
+                            // Add to clause match matrix.
+                            matched_entries.push_back(make_tuple(lit, other_idx, i));
+                            ws.count(lit);
+                        }
+                    };
+
+                    if (config.partner_index) {
+                        // Every D with D \ {x} == C \ {l}, up to hash collisions.
+                        // Visited in offset order, same as the scan below,
+                        // and charged as picking lmin and scanning F[lmin]
+                        // would be for the clauses found.
+                        partner_tmp.clear();
+                        const uint64_t key = clause_zhash(clause) - zobrist_lit(var);
+                        config.steps -= clause->size() - 1;
+                        partners.find(key, [&](ClOffset offs, int x) {
+                            config.steps--;
+                            if (x != var) partner_tmp.push_back(make_pair(offs, x));
+                        });
+                        std::sort(partner_tmp.begin(), partner_tmp.end());
+                        for (const auto& p : partner_tmp) {
+                            const Clause *other = ca.ptr(p.first);
+                            if (same_except(clause, var, other, p.second)) {
+                                add_partner(p.first, p.second);
+                            }
+                        }
+                        continue;
+                    }
+
+                    // A partner D contains C \ {l} and has one literal more
+                    uint64_t sig_rest = 0;
+                    for (int lit : *clause) {
+                        if (lit != var) sig_rest |= lit_sig(lit);
+                    }
+
+                    // foreach D in F[lmin] with |D| == |C|
+                    auto bucket = occ_bucket(lmin, clause->size());
+                    for (auto occ = bucket.first; occ != bucket.second; occ++) {
                         config.steps--;
-                        auto *other = &clauses[(other_idx)];
-                        if (other->deleted) {
+                        // Bits of D outside C \ {l}: must be none of C, and
+                        // at most one, from the extra literal
+                        const uint64_t extra = occ->sig & ~sig_rest;
+                        if ((sig_rest & ~occ->sig) != 0 || (extra & (extra - 1)) != 0) {
                             continue;
                         }
-
-                        if (clause->lits.size() != other->lits.size()) {
+                        ClOffset other_idx = occ->offs;
+                        const Clause *other = ca.ptr(other_idx);
+                        if (other->deleted) {
                             continue;
                         }
 
@@ -603,54 +1792,32 @@ public:
                             // diff := D \ C (limited to 2)
                             clause_sub(other, clause, diff, 2);
 
-                            // if diff = {lmin} then
-                            auto lit = diff[0];
-
-                            // TODO: potential performance improvement
-                            bool found = false;
-                            for (auto l : matched_lits) {
-                                if (l == lit) {
-                                    found = true;
-                                    break;
-                                }
-                            }
-
-                            // if lit not in Mlit then
-                            if (!found) {
-                                // Add to clause match matrix.
-                                matched_entries.push_back(make_tuple(lit, other_idx, i));
-                                matched_entries_lits.push_back(lit);
-                            }
+                            // if diff = {lmin} then. Always one literal, as
+                            // the clauses have the same size and the
+                            // difference is of multisets.
+                            assert(diff.size() == 1);
+                            add_partner(other_idx, diff[0]);
                         }
                     }
                 }
 
                 // lmax := most frequent literal in P
 
-                config.steps-= matched_entries_lits.size();
-                sort(matched_entries_lits.begin(), matched_entries_lits.end());
+                config.steps -= ws.counted.size();
 
                 int lmax = 0;
                 int lmax_count = 0;
 
-                std::vector<int> ties;
-                ties.reserve(16);
-                for (size_t i2 = 0; i2 < matched_entries_lits.size();) {
-                    int lit = matched_entries_lits[i2];
-                    int count = 0;
-
-                    while (i2 < matched_entries_lits.size() && matched_entries_lits[i2] == lit) {
-                        config.steps--;
-                        count++;
-                        i2++;
-                    }
+                auto& ties = ws.ties;
+                ties.clear();
+                for (int lit : ws.counted) {
+                    int count = ws.get_count(lit);
 
                     if (config.verbosity >= 3) {
                         cout << "  " << lit << " count: " << count << endl;
                     }
 
                     if (count > lmax_count) {
-                        lmax = lit;
                         lmax_count = count;
                         ties.clear();
                         ties.push_back(lit);
@@ -658,6 +1825,11 @@ public:
                         ties.push_back(lit);
                     }
                 }
+                ws.reset_counts();
+
+                // Ties, and lmax among them, go by literal order
+                std::sort(ties.begin(), ties.end());
+                if (!ties.empty()) lmax = ties[0];
 
                 if (lmax == 0) {
                     break;
@@ -685,10 +1857,11 @@ public:
 
                 // Break ties
                 if (ties.size() > 1 && tiebreak_mode == SBVA::Tiebreak::ThreeHop) {
-                    int max_heuristic_val = tiebreaking_heuristic(var, ties[0]);
+                    tiebreaking_heuristic(var, ties, tie_scores);
+                    int max_heuristic_val = tie_scores[0];
                     for (size_t i=1; i<ties.size(); i++) {
                         config.steps--;
-                        int h = tiebreaking_heuristic(var, ties[i]);
+                        int h = tie_scores[i];
                         if (h > max_heuristic_val) {
                             max_heuristic_val = h;
                             lmax = ties[i];
@@ -699,6 +1872,7 @@ public:
 
                 // Mlit := Mlit U {lmax}
                 matched_lits.push_back(lmax);
+                ws.set_matched(lmax);
 
                 // Mcls := Mcls U P[lmax]
                 matched_clauses_swap->resize(lmax_count);
@@ -710,7 +1884,7 @@ public:
                     int lit = get<0>(pair);
                     if (lit != lmax) continue;
 
-                    int clause_idx = get<1>(pair);
+                    ClOffset clause_idx = get<1>(pair);
                     int idx = get<2>(pair);
 
                     (*matched_clauses_swap)[(insert_idx)] = (*matched_clauses)[(idx)];
@@ -725,7 +1899,7 @@ public:
 
                 if (config.verbosity) {
                     cout << "  Mcls: ";
-                    for (int matched_clause : (*matched_clauses)) {
+                    for (ClOffset matched_clause : (*matched_clauses)) {
                         cout << matched_clause << " ";
                     }
                     cout << endl;
@@ -756,8 +1930,8 @@ public:
                 }
                 cout << endl;
                 cout << "  mclauses:\n";
-                for (int matched_clause : (*matched_clauses)) {
-                    clauses[matched_clause].print("   -> ");
+                for (ClOffset matched_clause : (*matched_clauses)) {
+                    ca.ptr(matched_clause)->print("   -> ");
                 }
                 cout << endl;
 
@@ -770,67 +1944,58 @@ public:
             num_vars += 1;
             int new_var = num_vars;
 
-            // Prepare to add new clauses.
-            uint32_t new_sz = num_clauses + matched_lit_count + matched_clause_count +
-                (config.preserve_model_cnt ? 1 : 0);
-            if (clauses.size() >= new_sz) clauses.resize(new_sz);
-            else clauses.insert(clauses.end(), new_sz - clauses.size(), Clause());
-
-            lit_to_clauses.insert(lit_to_clauses.end(), 2, vector<int>());
+            lit_to_clauses.insert(lit_to_clauses.end(), 2, OccList());
+            occ_sorted.insert(occ_sorted.end(), 2, 0);
             lit_count_adjust.insert(lit_count_adjust.end(), 2, 0);
-            if (sparsevec_lit_idx(new_var) >= adjacency_matrix_width) {
-                // The vectors must be constructed with a fixed, pre-determined width.
-                //
-                // This is quite an annoying limitation, as it means we have to re-construct
-                // all the vectors if we go above the width limit
-                adjacency_matrix_width = num_vars * 2;
-                adjacency_matrix.clear();
-            }
             adjacency_matrix.resize(num_vars);
+            var_version.resize(num_vars, 0);
+            adj_version++;
+            ws.grow(num_vars*2);
 
             // Add (f, lit) clauses.
             for (int i = 0; i < matched_lit_count; ++i) {
                 config.steps--;
                 int lit = matched_lits[(i)];
-                int new_clause = num_clauses + i;
 
-                auto cls = Clause();
-                cls.lits.push_back(lit);
-                cls.lits.push_back(new_var); // new_var is always largest value
-                (clauses)[new_clause] = cls;
+                new_lits.clear();
+                new_lits.push_back(lit);
+                new_lits.push_back(new_var); // new_var is always largest value
+                ClOffset new_clause = ca.alloc(new_lits.data(), new_lits.size());
+                adjacency_clause_delta(ca.ptr(new_clause), 1);
+                partner_index_add(new_clause);
 
-                lit_to_clauses[lit_index(lit)].push_back(new_clause);
-                lit_to_clauses[lit_index(new_var)].push_back(new_clause);
+                occ_add(lit, new_clause);
+                occ_add(new_var, new_clause);
 
                 if (config.generate_proof) {
-                    auto proof_lits = vector<int>();
-                    proof_lits.push_back(new_var); // new_var needs to be first for proof
-                    proof_lits.push_back(lit);
-                    proof.push_back(ProofClause(true, proof_lits));
+                    // new_var needs to be first for proof
+                    const int proof_lits[2] = {new_var, lit};
+                    proof_line(proof_lits, 2, false);
                 }
             }
 
             // Add (-f, ...) clauses.
             for (int i = 0; i < matched_clause_count; ++i) {
                 config.steps--;
-                int clause_idx = (*matched_clauses)[i];
-                auto new_clause = num_clauses + matched_lit_count + i;
+                ClOffset clause_idx = (*matched_clauses)[i];
 
-                auto cls = Clause();
-                cls.lits.push_back(-new_var); // -new_var is always smallest value
-                lit_to_clauses[lit_index(-new_var)].push_back(new_clause);
-
-                auto match_cls = clauses[(clause_idx)];
-                for (auto mlit : match_cls.lits) {
+                // Copy out first, allocating may move the arena
+                new_lits.clear();
+                new_lits.push_back(-new_var); // -new_var is always smallest value
+                for (auto mlit : *ca.ptr(clause_idx)) {
                     if (mlit != var) {
-                        cls.lits.push_back(mlit);
-                        lit_to_clauses[lit_index(mlit)].push_back(new_clause);
+                        new_lits.push_back(mlit);
                     }
                 }
-                clauses[new_clause] = cls;
+                ClOffset new_clause = ca.alloc(new_lits.data(), new_lits.size());
+                adjacency_clause_delta(ca.ptr(new_clause), 1);
+                partner_index_add(new_clause);
+                for (auto mlit : new_lits) {
+                    occ_add(mlit, new_clause);
+                }
 
                 if (config.generate_proof) {
-                    proof.push_back(ProofClause(true, cls.lits));
+                    proof_line(new_lits.data(), new_lits.size(), false);
                 }
             }
 
@@ -842,90 +2007,93 @@ public:
             //
             // The easiest way to fix this is to add one clause that constrains all(matched_lits) => -f
             if (config.preserve_model_cnt) {
-                int new_clause = num_clauses + matched_lit_count + matched_clause_count;
-                auto cls = Clause();
-                cls.lits.push_back(-new_var);
+                new_lits.clear();
+                new_lits.push_back(-new_var);
                 for (int i = 0; i < matched_lit_count; ++i) {
                     int lit = (matched_lits)[i];
-                    cls.lits.push_back(-lit);
-                    lit_to_clauses[lit_index(-lit)].push_back(new_clause);
+                    new_lits.push_back(-lit);
                 }
-
-                (clauses)[new_clause] = cls;
-                lit_to_clauses[(lit_index(-new_var))].push_back(new_clause);
+                ClOffset new_clause = ca.alloc(new_lits.data(), new_lits.size());
+                adjacency_clause_delta(ca.ptr(new_clause), 1);
+                partner_index_add(new_clause);
+                for (int i = 0; i < matched_lit_count; ++i) {
+                    occ_add(-(matched_lits)[i], new_clause);
+                }
+                occ_add(-new_var, new_clause);
 
                 if (config.generate_proof) {
-                    proof.push_back(ProofClause(true, cls.lits));
+                    proof_line(new_lits.data(), new_lits.size(), false);
                 }
             }
 
 
-            set<int> valid_clause_ids;
             for (int i = 0; i < matched_clause_count; ++i) {
                 config.steps--;
-                valid_clause_ids.insert((*matched_clauses_id)[i]);
+                ws.set_clause_id((*matched_clauses_id)[i]);
             }
 
             // Remove the old clauses.
             int removed_clause_count = 0;
-            lits_to_update.clear();
 
             for (auto to_remove : clauses_to_remove) {
-                int clause_idx = get<0>(to_remove);
+                ClOffset clause_idx = get<0>(to_remove);
                 int clause_id = get<1>(to_remove);
 
-                if (valid_clause_ids.find(clause_id) == valid_clause_ids.end()) {
+                if (!ws.has_clause_id(clause_id)) {
                     continue;
                 }
 
-                auto cls = &(clauses)[clause_idx];
+                Clause* cls = ca.ptr(clause_idx);
                 cls->deleted = true;
+                dead_words += Clause::header_words + cls->size();
+                adjacency_clause_delta(cls, -1);
+                partner_index_remove(clause_idx);
                 removed_clause_count += 1;
-                for (auto lit : cls->lits) {
+                for (auto lit : *cls) {
                     config.steps--;
                     lit_count_adjust[lit_index(lit)] -= 1;
-                    lits_to_update.insert(lit);
+                    ws.set_update(lit);
                 }
 
                 if (config.generate_proof) {
-                    proof.push_back(ProofClause(false, cls->lits));
+                    proof_line(cls->begin(), cls->size(), true);
                 }
             }
 
+            adjacency_finish_delta();
             adj_deleted += removed_clause_count;
             num_clauses += matched_lit_count + matched_clause_count + (config.preserve_model_cnt ? 1 : 0);
 
-            // Update priorities.
-            for (auto lit : lits_to_update) {
+            // Update priorities. The order of the pushes decides the order of
+            // ties in pq, so they go in the order of the unordered_set SBVA
+            // has always used. Inserted one by one as that grows its buckets
+            // the same way.
+            update_order.clear();
+            for (auto lit : ws.to_update) update_order.insert(lit);
+            for (auto lit : update_order) {
                 // Q.push(lit);
-                pq.push(make_pair(
-                    real_lit_count(lit),
-                    lit
-                ));
-
-                // Reset adjacency matrix
-                adjacency_matrix[sparsevec_lit_idx(lit)] = Eigen::SparseVector<int>(adjacency_matrix_width);
+                pq.push(real_lit_count(lit), lit);
             }
 
             // Q.push(new_var);
-            pq.push(make_pair(
-                lit_to_clauses[lit_index(new_var)].size() + (lit_count_adjust)[lit_index(new_var)],
-                new_var
-            ));
+            pq.push(real_lit_count(new_var), new_var);
 
             // Q.push(-new_var);
-            pq.push(make_pair(
-                lit_to_clauses[lit_index(-new_var)].size() + (lit_count_adjust)[lit_index(-new_var)],
-                -new_var
-            ));
+            pq.push(real_lit_count(-new_var), -new_var);
 
             // Q.push(var);
-            pq.push(make_pair(
-                lit_to_clauses[lit_index(var)].size() + (lit_count_adjust)[lit_index(var)],
-                var
-            ));
+            pq.push(real_lit_count(var), var);
 
             num_replacements += 1;
+
+            if (dead_words > ca.end_offset() * compact_dead_ratio) {
+                compact();
+                build_partner_index();
+            }
+        }
+        if (config.verbosity) {
+            cout << "c tiebreak cache hits: " << tie_cache.hits
+                << " misses: " << tie_cache.misses << endl;
         }
         delete matched_clauses;
         delete matched_clauses_swap;
@@ -939,20 +2107,289 @@ private:
     size_t num_clauses = 0;
     size_t curr_clause = 0;
     int adj_deleted = 0;
-    vector<Clause> clauses;
+    // Whether any clause was added without its literals sorted
+    bool need_sort = false;
+
+    // Words of the arena taken by deleted clauses. Once they are more than
+    // compact_dead_ratio of it, run_sbva calls compact().
+    static constexpr double compact_dead_ratio = 0.5;
+    size_t dead_words = 0;
+    ClauseAllocator ca;
     SBVA::Config& config;
-    ClauseCache* cache = nullptr;
+
+    // Bytes of input per thread in read_clauses_chunked(), smaller chunks are
+    // not worth a thread
+    static constexpr size_t chunk_min = 1U << 16;
+    static constexpr size_t chunk_max = 1U << 24;
+
+    // Output formatting buffers of write_round(), one per thread. Rounds
+    // below write_parallel_bytes are formatted on one thread.
+    vector<vector<char>> write_bufs;
+    static constexpr size_t write_round_bytes = 1U << 22;
+    static constexpr size_t write_parallel_bytes = 1U << 20;
 
     // maps each literal to a vector of clauses that contain it
-    vector< vector<int> > lit_to_clauses;
+    vector<OccList> lit_to_clauses;
+    vector<uint32_t> occ_sorted; // length of the part of each list sorted by size
     vector<int> lit_count_adjust;
 
-    uint32_t adjacency_matrix_width;
-    vector< Eigen::SparseVector<int> > adjacency_matrix;
-    map< int, int > tmp_heuristic_cache_full;
+    // Partner clauses for the matching loop of run_sbva, built when it starts
+    PartnerIndex partners;
+    vector<pair<ClOffset, int>> partner_tmp;
+    vector<pair<ClOffset, int>> mcls_tmp;
+    MatchWorkspace ws;
+
+    vector<AdjRow> adjacency_matrix;
+    vector<uint32_t> adj_tmp;
+    vector<uint32_t> adj_touched;
+
+    // Tie-break scratch, see tiebreaking_heuristic(). Entries stamped with
+    // tie_epoch are valid for the current outer iteration of run_sbva.
+    static constexpr size_t tie_parallel_work = 1U << 16;
+    uint32_t tie_var = std::numeric_limits<uint32_t>::max();
+    uint32_t tie_epoch = 0;
+    vector<int> tie_dense;
+    vector<uint32_t> tie_dense_idxs;
+    vector<uint32_t> tie_nb_stamp;
+    vector<int> tie_nb_dot;
+    vector<uint32_t> tie_score_stamp;
+    vector<int> tie_score;
+    vector<uint32_t> tie_todo;
+    vector<uint32_t> tie_nb_todo;
+
+    // Persistent tie-break scores. adj_version counts the replacements done,
+    // var_version[v] is the adj_version at which a clause containing v was
+    // last added or removed.
+    TieCache tie_cache;
+    uint32_t adj_version = 0;
+    vector<uint32_t> var_version;
+
+    // Proof written so far, see proof_line()
+    FILE* proof_spill = nullptr;
+    Writer* proof_out = nullptr;
+    ProofFormat proof_fmt = ProofFormat::BinaryDrat;
+    bool proof_direct = false; // proof_out is the file of set_proof_output()
+};
+
+// Replays a proof written by Formula::to_proof() with only the checks the
+// shape of an SBVA step needs. The first literal of every added clause is the
+// fresh variable of the current step, or starts a new step with a variable
+// larger than any before. No other clause has that variable, so the RAT
+// candidates of an added clause are the clauses of the step with the opposite
+// pivot, and every resolvent with them must be in the formula or be a
+// tautology. Clauses are compared sorted and without repeated literals.
+class ProofChecker {
+public:
+    explicit ProofChecker(SBVA::Config& _config) : config(_config) {}
+
+    void load(FILE* input) {
+        uint32_t nvars;
+        read_clauses(input, clauses, nvars);
+        max_var = nvars;
+    }
+
+    bool replay(FILE* fproof) {
+        Reader in(fproof);
+        binary = looks_binary(in);
+        vector<int> lits;
+        bool deletion;
+        while (true) {
+            line++;
+            if (!next_line(in, lits, deletion)) break;
+            if (!(deletion ? remove(lits) : add(lits))) return false;
+        }
+        return error.empty();
+    }
+
+    // The formula after the proof must be the one in output
+    bool compare(FILE* output) {
+        Clauses expected;
+        uint32_t nvars;
+        read_clauses(output, expected, nvars);
+        if (expected != clauses) {
+            error = "the formula after the proof is not the output CNF";
+            return false;
+        }
+        return true;
+    }
+
+    string error;
+
+private:
+    struct LitsHash {
+        size_t operator()(const vector<int>& lits) const {
+            return murmur3_vec((uint32_t*)lits.data(), lits.size(), 0);
+        }
+    };
+    // Clause to the number of times it is in the formula
+    using Clauses = unordered_map<vector<int>, uint32_t, LitsHash>;
+
+    void read_clauses(FILE* fin, Clauses& cls, uint32_t& nvars) {
+        Formula f(config);
+        f.read_cnf(fin);
+        nvars = f.get_num_vars();
+        cls.reserve(f.get_num_clauses());
+        vector<int> lits;
+        const int* b = nullptr;
+        uint32_t sz = 0;
+        for (ClOffset offs = f.live_at(0, b, sz); offs < f.end_offset();
+            offs = f.live_at(f.next_offset(offs), b, sz))
+        {
+            lits.assign(b, b + sz);
+            normalize(lits, false);
+            cls[lits]++;
+        }
+    }
+
+    // Sorts lits and removes repeated literals, keeping lits[0] first if
+    // keep_pivot is set
+    static void normalize(vector<int>& lits, bool keep_pivot) {
+        auto b = lits.begin() + (keep_pivot && !lits.empty() ? 1 : 0);
+        sort(b, lits.end());
+        lits.erase(unique(b, lits.end()), lits.end());
+        if (keep_pivot && !lits.empty()) {
+            auto rest = std::remove(b, lits.end(), lits[0]);
+            lits.erase(rest, lits.end());
+        }
+    }
+
+    // Binary DRAT, as drat-trim tells it from text: the first block has a
+    // byte that is not printable. Every binary line ends with a 0 byte.
+    static bool looks_binary(Reader& in) {
+        if (in.peek() == EOF) return false;
+        const char* b;
+        const char* e;
+        in.remaining(b, e);
+        e = std::min(e, b + 4096);
+        for (; b != e; b++) {
+            const unsigned char c = *b;
+            if ((c < 32 && c != '\n' && c != '\r' && c != '\t') || c == 127) return true;
+        }
+        return false;
+    }
+
+    // Reads one proof line, text or binary DRAT. Returns false at the end of
+    // the proof.
+    bool next_line(Reader& in, vector<int>& lits, bool& deletion) {
+        lits.clear();
+        deletion = false;
+        if (!binary) in.skip_whitespace();
+        int c = in.peek();
+        while (!binary && c == 'c') {
+            in.skip_line();
+            in.skip_whitespace();
+            c = in.peek();
+        }
+        if (c == EOF) return false;
+        if (binary) {
+            if (c != 'a' && c != 'd') return fail("bad binary DRAT line");
+            in.advance();
+            deletion = c == 'd';
+        } else if (c == 'd') {
+            in.advance();
+            deletion = true;
+        }
+
+        if (binary) {
+            uint64_t v;
+            while (true) {
+                if (!in.read_varint(v)) return fail("truncated binary DRAT line");
+                if (v == 0) return true;
+                if (v < 2 || v > (uint64_t)std::numeric_limits<int>::max() * 2 + 1) return fail("literal out of range");
+                lits.push_back((int)drat_unlit(v));
+            }
+        }
+        int lit;
+        while (true) {
+            in.skip_whitespace();
+            if (!in.parse_int(lit)) return fail("bad DRAT line");
+            if (lit == 0) return true;
+            lits.push_back(lit);
+        }
+    }
+
+    bool add(vector<int>& lits) {
+        normalize(lits, true);
+        if (lits.empty()) return fail("empty clause added");
+        const int pivot = lits[0];
+        const uint32_t var = abs(pivot);
+        if (var > max_var) {
+            cur_var = max_var = var;
+            pos.clear();
+            neg.clear();
+        } else if (var != cur_var) {
+            return fail("added clause does not start with the fresh variable");
+        }
+        for (size_t i = 1; i < lits.size(); i++) {
+            if ((uint32_t)abs(lits[i]) >= cur_var) return fail("fresh variable not first in added clause");
+        }
+
+        // Resolve on the pivot with every clause of the step on the other side
+        const vector<vector<int>>& others = pivot > 0 ? neg : pos;
+        for (const auto& other : others) {
+            config.steps--;
+            resolvent.assign(lits.begin() + 1, lits.end());
+            resolvent.insert(resolvent.end(), other.begin(), other.end());
+            normalize(resolvent, false);
+            if (tautology(resolvent)) continue;
+            auto it = clauses.find(resolvent);
+            if (it == clauses.end()) return fail("added clause is not RAT on the fresh variable");
+        }
+        (pivot > 0 ? pos : neg).emplace_back(lits.begin() + 1, lits.end());
+
+        vector<int> key = lits;
+        normalize(key, false);
+        clauses[key]++;
+        return true;
+    }
+
+    bool remove(vector<int>& lits) {
+        normalize(lits, false);
+        auto it = clauses.find(lits);
+        if (it == clauses.end()) return fail("deleted clause is not in the formula");
+        if (--it->second == 0) clauses.erase(it);
+
+        // Only a clause with the fresh variable can be one of the step. SBVA
+        // never deletes those, so the scan below does not run for its proofs.
+        int pivot = 0;
+        for (int lit : lits) {
+            if ((uint32_t)abs(lit) == cur_var) pivot = lit;
+        }
+        if (pivot == 0) return true;
+        lits.erase(std::find(lits.begin(), lits.end(), pivot));
+        vector<vector<int>>& side = pivot > 0 ? pos : neg;
+        for (size_t i = 0; i < side.size(); i++) {
+            if (side[i] != lits) continue;
+            side[i].swap(side.back());
+            side.pop_back();
+            break;
+        }
+        return true;
+    }
+
+    // lits is sorted
+    static bool tautology(const vector<int>& lits) {
+        for (int lit : lits) {
+            if (lit < 0 && binary_search(lits.begin(), lits.end(), -lit)) return true;
+        }
+        return false;
+    }
+
+    bool fail(const char* msg) {
+        if (error.empty()) error = string(msg) + " at proof line " + std::to_string(line);
+        return false;
+    }
 
-    // proof storage
-    vector<ProofClause> proof;
+    SBVA::Config& config;
+    Clauses clauses;
+    uint32_t max_var = 0;
+    uint32_t cur_var = 0;
+    // Clauses of the current step with cur_var and -cur_var, without it
+    vector<vector<int>> pos;
+    vector<vector<int>> neg;
+    vector<int> resolvent;
+    size_t line = 0;
+    bool binary = false;
 };
 
 }
@@ -971,16 +2408,22 @@ CNF::~CNF() {
 void CNF::run(SBVA::Tiebreak t) {
     Formula* f = (Formula*)data;
     f->run_sbva(t);
+    f->finish_proof();
+}
+
+std::pair<int, int> CNF::to_cnf(FILE* file, Compression c, CnfFormat fmt) {
+    Formula* f = (Formula*)data;
+    return f->to_cnf(file, c, fmt);
 }
 
-std::pair<int, int> CNF::to_cnf(FILE* file) {
+void CNF::set_proof_output(FILE* file, Compression c, ProofFormat fmt) {
     Formula* f = (Formula*)data;
-    return f->to_cnf(file);
+    f->set_proof_output(file, c, fmt);
 }
 
-void CNF::to_proof(FILE* file) {
+void CNF::to_proof(FILE* file, Compression c, ProofFormat fmt) {
     Formula* f = (Formula*)data;
-    f->to_proof(file);
+    f->to_proof(file, c, fmt);
 }
 
 vector<int> CNF::get_cnf(uint32_t& ret_num_vars, uint32_t& ret_num_cls) {
@@ -989,6 +2432,44 @@ vector<int> CNF::get_cnf(uint32_t& ret_num_vars, uint32_t& ret_num_cls) {
 }
 
 
+uint32_t CNF::num_vars() const {
+    const Formula* f = (const Formula*)data;
+    return f->get_num_vars();
+}
+
+uint32_t CNF::num_clauses() const {
+    const Formula* f = (const Formula*)data;
+    return f->get_num_clauses();
+}
+
+ClauseRange CNF::clauses() const {
+    const Formula* f = (const Formula*)data;
+    return ClauseRange{ClauseIterator(f, 0), ClauseIterator(f, f->end_offset())};
+}
+
+size_t CNF::export_size() const {
+    const Formula* f = (const Formula*)data;
+    return f->export_size();
+}
+
+size_t CNF::export_cnf(int* buf, size_t cap) const {
+    const Formula* f = (const Formula*)data;
+    return f->export_cnf(buf, cap);
+}
+
+ClauseIterator::ClauseIterator(const void* _formula, uint32_t _offs) : formula(_formula) {
+    seek(_offs);
+}
+
+ClauseIterator& ClauseIterator::operator++() {
+    seek(((const Formula*)formula)->next_offset(offs));
+    return *this;
+}
+
+void ClauseIterator::seek(uint32_t _offs) {
+    offs = ((const Formula*)formula)->live_at(_offs, cur.lits, cur.size);
+}
+
 void CNF::init_cnf(uint32_t num_vars, Config& config) {
     assert(data == nullptr);
     Formula* f = new Formula(config);
@@ -1001,6 +2482,11 @@ void CNF::add_cl(const std::vector<int>& cl_lits) {
     f->add_cl(cl_lits);
 }
 
+void CNF::add_clauses(const int* lits, size_t n, uint32_t flags) {
+    Formula* f = (Formula*)data;
+    f->add_clauses(lits, n, flags & AddSorted);
+}
+
 void CNF::finish_cnf() {
     Formula* f = (Formula*)data;
     f->finish_cnf();
@@ -1014,6 +2500,19 @@ void CNF::parse_cnf(FILE* file, Config& config) {
     data = (void*)f;
 }
 
+bool verify_proof(FILE* input, FILE* output, FILE* proof, Config& config, std::string& error) {
+    double my_time = cpuTime();
+    ProofChecker checker(config);
+    checker.load(input);
+    const bool ok = checker.replay(proof) && checker.compare(output);
+    error = checker.error;
+    if (config.verbosity) {
+        cout << "c checked proof" << (ok ? "" : " (failed)")
+            << " T: " << std::setprecision(2) << std::fixed << (cpuTime() - my_time) << endl;
+    }
+    return ok;
+}
+
 const char* get_version_tag() {
     return SBVAImpl::get_version_tag();
 }
@@ -23,8 +23,11 @@ THE SOFTWARE.
 
 #pragma once
 
+#include <cstddef>
 #include <cstdio>
+#include <iterator>
 #include <limits>
+#include <string>
 #include <vector>
 #include <cstdint>
 #include <utility>
@@ -41,11 +44,16 @@ namespace SBVA {
 struct Config {
     uint32_t verbosity = 0;
     bool generate_proof = 0;
+    // Budget for the search. Loading the CNF, removing duplicates and
+    // building the occurrence lists are not charged.
     int64_t steps = std::numeric_limits<int64_t>::max();
     unsigned int max_replacements = 0;
     bool preserve_model_cnt = 0;
     uint32_t matched_lits_cutoff = 2; // the larger, the more strict
     uint32_t matched_cls_cutoff = 2;  // the larger, the more strict
+    uint32_t num_threads = 1;
+    bool partner_index = false; // hash index instead of occurrence list scans, 16 bytes per literal
+    bool dedup_sort = false; // remove duplicate clauses by sorting after loading, uses less memory
 };
 
 enum Tiebreak {
@@ -53,22 +61,120 @@ enum Tiebreak {
     None, // use sorted order (should be equivalent to original BVA)
 };
 
+// Compression of the output of to_cnf() and of the proof. Compressed input is
+// detected by parse_cnf() itself.
+enum class Compression {
+    None,
+    Gzip,
+    Xz,
+    Zstd,
+};
+
+// Format of the output of to_cnf(). parse_cnf() recognises both.
+enum class CnfFormat {
+    Dimacs,
+    Binary, // compact, versioned binary format, see bincnf.h
+    BinaryHashes, // Binary with the clause hashes, so loading it skips hashing
+};
+
+// Format of the proof
+enum class ProofFormat {
+    Drat,
+    BinaryDrat, // 'a'/'d' bytes and varint literals, as read by drat-trim
+};
+
+// Flags of CNF::add_clauses()
+enum AddFlags : uint32_t {
+    // The literals of every clause are in increasing order, so they need not
+    // be sorted. Checked while loading: if any clause is out of order, all
+    // clauses are sorted as without the flag.
+    AddSorted = 1,
+};
+
+// One clause of a CNF, pointing into its storage
+struct ClauseSpan {
+    const int* lits = nullptr;
+    uint32_t size = 0;
+
+    const int* begin() const { return lits; }
+    const int* end() const { return lits + size; }
+};
+
+// Walks the clauses of a CNF in place, see CNF::clauses()
+class SBVA_PUBLIC ClauseIterator {
+public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = ClauseSpan;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const ClauseSpan*;
+    using reference = const ClauseSpan&;
+
+    ClauseIterator() = default;
+
+    const ClauseSpan& operator*() const { return cur; }
+    const ClauseSpan* operator->() const { return &cur; }
+    ClauseIterator& operator++();
+    bool operator==(const ClauseIterator& other) const { return offs == other.offs; }
+    bool operator!=(const ClauseIterator& other) const { return offs != other.offs; }
+
+private:
+    friend struct CNF;
+    ClauseIterator(const void* _formula, uint32_t _offs);
+    // First clause at _offs or after it
+    void seek(uint32_t _offs);
+
+    const void* formula = nullptr;
+    uint32_t offs = 0;
+    ClauseSpan cur;
+};
+
+struct ClauseRange {
+    ClauseIterator first;
+    ClauseIterator last;
+
+    ClauseIterator begin() const { return first; }
+    ClauseIterator end() const { return last; }
+};
+
 struct SBVA_PUBLIC CNF {
     CNF();
     ~CNF();
     void run(Tiebreak t);
 
-    std::pair<int, int> to_cnf(FILE*);
+    std::pair<int, int> to_cnf(FILE*, Compression c = Compression::None,
+        CnfFormat fmt = CnfFormat::Dimacs);
     std::vector<int> get_cnf(uint32_t& ret_num_vars, uint32_t& ret_num_cls);
 
-    void to_proof(FILE*);
+    // The same without copying: the clauses are read where they are stored,
+    // until the formula is changed by run() or by adding clauses
+    uint32_t num_vars() const;
+    uint32_t num_clauses() const;
+    ClauseRange clauses() const;
 
-    // Read in CNF from file
+    // Writes what get_cnf() returns into buf, which has room for cap ints.
+    // Returns the number of ints written, export_size(), or 0 if that does
+    // not fit.
+    size_t export_size() const;
+    size_t export_cnf(int* buf, size_t cap) const;
+
+    void to_proof(FILE*, Compression c = Compression::None,
+        ProofFormat fmt = ProofFormat::Drat);
+
+    // Writes the proof to the file as run() makes it, instead of keeping it
+    // for to_proof(). Call it after parse_cnf() or init_cnf() and before
+    // run(); the proof is complete when run() returns.
+    void set_proof_output(FILE*, Compression c = Compression::None,
+        ProofFormat fmt = ProofFormat::Drat);
+
+    // Read in CNF from file, DIMACS or binary, gzip, xz or zstd compressed or not
     void parse_cnf(FILE* file, Config& config);
 
     // This is how to add a CNF clause by clause
     void init_cnf(uint32_t num_vars, Config& config);
     void add_cl(const std::vector<int>& cl_lits);
+    // Or many clauses at once, from lits[0, n) with every clause ended by 0.
+    // The 0 after the last one may be left out.
+    void add_clauses(const int* lits, size_t n, uint32_t flags = 0);
     void finish_cnf();
 
     void* data = nullptr;
@@ -78,4 +184,14 @@ SBVA_PUBLIC const char* get_version_tag();
 SBVA_PUBLIC const char* get_version_sha1();
 SBVA_PUBLIC const char* get_compilation_env();
 
+// Checks that proof, as written by to_proof() in any format, turns the CNF in
+// input into the one in output. Only the shape of SBVA steps is checked, so
+// this takes linear time but rejects proofs of other tools. Returns false and
+// sets error if the proof is wrong.
+SBVA_PUBLIC bool verify_proof(FILE* input, FILE* output, FILE* proof,
+    Config& config, std::string& error);
+
+// Whether this build can read and write the given compression
+SBVA_PUBLIC bool compression_supported(Compression c);
+
 }
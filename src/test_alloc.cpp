@@ -0,0 +1,88 @@
+/******************************************
+Copyright (C) 2024 Mate Soos
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+***********************************************/
+
+// Checks that the outer iterations of run_sbva that do not replace anything
+// do not allocate. The formula has one such iteration per group of clauses,
+// so the number of allocations in run() must not grow with the number of
+// groups, apart from the logarithmic growth of vectors.
+
+#include "sbva.h"
+#include <atomic>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <vector>
+using std::cout;
+using std::endl;
+using std::vector;
+
+static std::atomic<size_t> num_allocs(0);
+
+void* operator new(size_t sz) {
+    num_allocs++;
+    void* p = malloc(sz == 0 ? 1 : sz);
+    if (p == nullptr) throw std::bad_alloc();
+    return p;
+}
+void operator delete(void* p) noexcept { free(p); }
+void operator delete(void* p, size_t) noexcept { free(p); }
+
+// Clauses (a_i, b_i, c) and (d_i, b_i, c). Trying a_i finds d_i as partner
+// literal, but replacing them would not shrink the formula.
+static size_t allocs_in_run(uint32_t groups) {
+    SBVA::Config config;
+    SBVA::CNF cnf;
+    const int c = 1;
+    cnf.init_cnf(1 + groups*3, config);
+    for (uint32_t i = 0; i < groups; i++) {
+        const int a = 2 + i*3;
+        cnf.add_cl({a, a+1, c});
+        cnf.add_cl({a+2, a+1, c});
+    }
+    cnf.finish_cnf();
+
+    size_t before = num_allocs;
+    cnf.run(SBVA::Tiebreak::ThreeHop);
+    size_t allocs = num_allocs - before;
+
+    uint32_t num_vars;
+    uint32_t num_cls;
+    cnf.get_cnf(num_vars, num_cls);
+    if (num_cls != groups*2) {
+        cout << "ERROR: expected no replacements, got " << num_cls << " clauses" << endl;
+        exit(1);
+    }
+    return allocs;
+}
+
+int main() {
+    size_t small = allocs_in_run(100);
+    size_t large = allocs_in_run(10000);
+    cout << "allocations in run(): " << small << " for 100 groups, "
+        << large << " for 10000 groups" << endl;
+    if (large > small + 32) {
+        cout << "ERROR: iterations allocate" << endl;
+        return 1;
+    }
+    cout << "OK" << endl;
+    return 0;
+}
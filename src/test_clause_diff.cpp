@@ -0,0 +1,172 @@
+/******************************************
+Copyright (C) 2024 Mate Soos
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+***********************************************/
+
+// Checks clause_diff() against the merge of two sorted clauses:
+// - for clauses of the same and of different sizes
+// - when a clause repeats a literal
+// With "bench" as argument, also times both on clause pairs like the ones
+// the partner scan of run_sbva sees.
+
+#include "clause_diff.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <vector>
+using std::cout;
+using std::endl;
+using std::vector;
+using namespace SBVAImpl;
+
+typedef uint32_t (*ClauseDiffFn)(const int*, uint32_t, const int*, uint32_t, int*, uint32_t);
+
+struct Kernel {
+    const char* name;
+    ClauseDiffFn fn;
+};
+
+static uint32_t dispatched(const int* a, uint32_t na, const int* b, uint32_t nb, int* out, uint32_t limit) {
+    return clause_diff(a, na, b, nb, out, limit);
+}
+
+static vector<Kernel> kernels() {
+    return {
+        {"merge", clause_diff_merge},
+        {"dispatched", dispatched},
+    };
+}
+
+static uint32_t seed = 1;
+static uint32_t rnd() {
+    seed = seed * 1103515245 + 12345;
+    return (seed >> 16) & 0x7fff;
+}
+
+// Sorted clause of distinct literals over vars 1..num_vars
+static vector<int> rnd_clause(uint32_t sz, uint32_t num_vars) {
+    vector<int> cl;
+    while (cl.size() < sz) {
+        int lit = 1 + rnd() % num_vars;
+        if (rnd() & 1) lit = -lit;
+        bool dup = false;
+        for (int l : cl) dup |= (l == lit || l == -lit);
+        if (!dup) cl.push_back(lit);
+    }
+    std::sort(cl.begin(), cl.end());
+    return cl;
+}
+
+// A copy of a with `changes` literals replaced
+static vector<int> mutate(const vector<int>& a, uint32_t changes, uint32_t num_vars) {
+    vector<int> b = a;
+    for (uint32_t c = 0; c < changes && !b.empty(); c++) {
+        uint32_t pos = rnd() % b.size();
+        while (true) {
+            int lit = 1 + rnd() % num_vars;
+            if (rnd() & 1) lit = -lit;
+            bool dup = false;
+            for (int l : b) dup |= (l == lit || l == -lit);
+            if (!dup) {
+                b[pos] = lit;
+                break;
+            }
+        }
+    }
+    std::sort(b.begin(), b.end());
+    return b;
+}
+
+// Some literal of cl repeated over another, cl stays sorted
+static void repeat_lit(vector<int>& cl) {
+    if (cl.size() < 2) return;
+    const uint32_t from = rnd() % cl.size();
+    cl[rnd() % cl.size()] = cl[from];
+    std::sort(cl.begin(), cl.end());
+}
+
+static int check() {
+    const auto ks = kernels();
+    int out_ref[64];
+    int out[64];
+    for (uint32_t iter = 0; iter < 200000; iter++) {
+        const uint32_t na = 1 + rnd() % 40;
+        const uint32_t nb = (rnd() & 1) ? na : 1 + rnd() % 40;
+        auto a = rnd_clause(na, 60);
+        auto b = (na == nb) ? mutate(a, rnd() % 3, 60) : rnd_clause(nb, 60);
+        if (rnd() % 8 == 0) repeat_lit(a);
+        if (rnd() % 8 == 0) repeat_lit(b);
+        const uint32_t limit = 1 + rnd() % (na + 1);
+
+        uint32_t n_ref = clause_diff_merge(a.data(), na, b.data(), nb, out_ref, limit);
+        for (const auto& k : ks) {
+            uint32_t n = k.fn(a.data(), na, b.data(), nb, out, limit);
+            if (n != n_ref || memcmp(out, out_ref, n * sizeof(int)) != 0) {
+                cout << "ERROR: kernel " << k.name << " differs for sizes "
+                    << na << " and " << nb << ", limit " << limit << endl;
+                return 1;
+            }
+        }
+    }
+    return 0;
+}
+
+static void bench() {
+    const auto ks = kernels();
+    const uint32_t pairs = 4096;
+    const uint32_t reps = 500;
+    cout << "ns per call, same-size pairs, 3 in 4 differ early" << endl;
+    cout << "size";
+    for (const auto& k : ks) cout << "\t" << k.name;
+    cout << endl;
+    for (uint32_t sz : {2U, 3U, 4U, 5U, 6U, 8U, 12U, 16U, 24U, 32U, 64U}) {
+        vector<vector<int>> as;
+        vector<vector<int>> bs;
+        for (uint32_t i = 0; i < pairs; i++) {
+            as.push_back(rnd_clause(sz, 1000));
+            // Mostly non-partners, as in the partner scan
+            bs.push_back((rnd() % 4) ? mutate(as.back(), 1 + rnd() % sz, 1000) : mutate(as.back(), 1, 1000));
+        }
+        cout << sz;
+        for (const auto& k : ks) {
+            int out[3];
+            uint64_t total = 0;
+            auto start = std::chrono::steady_clock::now();
+            for (uint32_t r = 0; r < reps; r++) {
+                for (uint32_t i = 0; i < pairs; i++) {
+                    total += k.fn(as[i].data(), sz, bs[i].data(), sz, out, 3);
+                }
+            }
+            auto end = std::chrono::steady_clock::now();
+            double ns = std::chrono::duration<double, std::nano>(end - start).count();
+            cout << "\t" << ns / ((double)pairs * reps) << (total == 0 ? "?" : "");
+        }
+        cout << endl;
+    }
+}
+
+int main(int argc, char** argv) {
+    int ret = check();
+    if (ret == 0) cout << "OK" << endl;
+    if (argc > 1 && strcmp(argv[1], "bench") == 0) bench();
+    return ret;
+}
@@ -0,0 +1,138 @@
+/******************************************
+Copyright (C) 2024 Mate Soos
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+***********************************************/
+
+// Checks that loading on several threads gives the same formula as loading
+// on one, with both ways of removing duplicate clauses, before and after
+// running SBVA. Adding all clauses at once, sorted or not, must give the
+// same formula as adding them one by one, also if the clauses are said to be
+// sorted but are not.
+
+#include "sbva.h"
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <vector>
+using std::cout;
+using std::endl;
+using std::vector;
+
+static const uint32_t num_vars = 60;
+
+// Random clauses over few variables, with every tenth one repeated with its
+// literals shuffled, so there are many duplicates, spread over the input.
+static vector<vector<int>> make_formula() {
+    vector<vector<int>> cls;
+    uint32_t seed = 4321;
+    auto rnd = [&]() { seed = seed * 1103515245 + 12345; return (seed >> 16) & 0x7fff; };
+    for (int i = 0; i < 3000; i++) {
+        if (i % 10 == 9) {
+            vector<int> cl = cls[rnd() % cls.size()];
+            for (size_t j = cl.size(); j > 1; j--) std::swap(cl[j-1], cl[rnd() % j]);
+            cls.push_back(cl);
+            continue;
+        }
+        vector<int> cl;
+        uint32_t sz = 1 + rnd() % 4;
+        while (cl.size() < sz) {
+            int lit = 1 + rnd() % num_vars;
+            if (rnd() & 1) lit = -lit;
+            bool dup = false;
+            for (int l : cl) dup |= (l == lit || l == -lit);
+            if (!dup) cl.push_back(lit);
+        }
+        cls.push_back(cl);
+    }
+    return cls;
+}
+
+enum class Add {
+    OneByOne,
+    Flat,
+    FlatSorted,
+    FlatFlaggedSorted, // not sorted, but says it is
+};
+
+static vector<int> load(const vector<vector<int>>& cls, uint32_t threads, bool dedup_sort,
+    bool run_sbva, uint32_t& num_cls, Add add = Add::OneByOne)
+{
+    SBVA::Config config;
+    config.num_threads = threads;
+    config.dedup_sort = dedup_sort;
+    SBVA::CNF cnf;
+    cnf.init_cnf(num_vars, config);
+    if (add == Add::OneByOne) {
+        for (const auto& cl : cls) cnf.add_cl(cl);
+    } else {
+        vector<int> flat;
+        for (auto cl : cls) {
+            if (add == Add::FlatSorted) std::sort(cl.begin(), cl.end());
+            flat.insert(flat.end(), cl.begin(), cl.end());
+            flat.push_back(0);
+        }
+        // Split in two, at a clause boundary, and without the last 0
+        const size_t half = std::find(flat.begin() + flat.size()/2, flat.end(), 0) - flat.begin() + 1;
+        const uint32_t flags = add == Add::Flat ? 0 : (uint32_t)SBVA::AddSorted;
+        cnf.add_clauses(flat.data(), half, flags);
+        cnf.add_clauses(flat.data() + half, flat.size() - half - 1, flags);
+    }
+    cnf.finish_cnf();
+    if (run_sbva) cnf.run(SBVA::Tiebreak::ThreeHop);
+
+    uint32_t nvars;
+    return cnf.get_cnf(nvars, num_cls);
+}
+
+int main() {
+    auto cls = make_formula();
+    for (bool run_sbva : {false, true}) {
+        uint32_t num_cls_ref;
+        auto ref = load(cls, 1, false, run_sbva, num_cls_ref);
+        if (!run_sbva && num_cls_ref >= cls.size()) {
+            cout << "ERROR: no duplicates were removed" << endl;
+            return 1;
+        }
+        for (uint32_t threads : {1, 2, 3, 8}) {
+            for (bool dedup_sort : {false, true}) {
+                uint32_t num_cls;
+                auto res = load(cls, threads, dedup_sort, run_sbva, num_cls);
+                if (res != ref || num_cls != num_cls_ref) {
+                    cout << "ERROR: " << threads << " threads" << (dedup_sort ? " with sort dedup" : "")
+                        << (run_sbva ? " after SBVA" : "") << " give " << num_cls
+                        << " clauses, one thread gives " << num_cls_ref << endl;
+                    return 1;
+                }
+            }
+        }
+        for (Add add : {Add::Flat, Add::FlatSorted, Add::FlatFlaggedSorted}) {
+            uint32_t num_cls;
+            auto res = load(cls, 1, false, run_sbva, num_cls, add);
+            if (res != ref || num_cls != num_cls_ref) {
+                cout << "ERROR: adding all clauses at once" << (add != Add::Flat ? " with AddSorted" : "")
+                    << (run_sbva ? " after SBVA" : "") << " gives " << num_cls
+                    << " clauses, one by one gives " << num_cls_ref << endl;
+                return 1;
+            }
+        }
+    }
+    cout << "OK" << endl;
+    return 0;
+}
@@ -0,0 +1,331 @@
+/******************************************
+Copyright (C) 2024 Mate Soos
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+***********************************************/
+
+// Checks the DIMACS parser and the output:
+// - the memory-mapped and the buffered path give the same formula
+// - clauses may span or share lines
+// - both ways of removing duplicate clauses keep the first one
+// - the chunked parser on several threads gives the same formula
+// - compressed and binary output read back the same
+// - output written on several threads is the same
+// - reading the clauses in place gives the same formula
+
+#include "sbva.h"
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+using std::cout;
+using std::endl;
+using std::vector;
+
+static const char* cnf_text =
+    "c a comment\n"
+    "p cnf 5 6\n"
+    "1 -2 0 2 3 0\n"
+    "-1\n"
+    "  4\n"
+    "5 0\n"
+    "c comment between clauses 1 2 0\n"
+    "3 -4 0 -5 1 0\n"
+    "2 4";
+
+static const vector<int> expected = {
+    -2, 1, 0,
+    2, 3, 0,
+    -1, 4, 5, 0,
+    -4, 3, 0,
+    -5, 1, 0,
+    2, 4, 0,
+};
+
+static int check(FILE* f, const char* name) {
+    if (f == nullptr) {
+        cout << "ERROR: could not open input for " << name << endl;
+        return 1;
+    }
+    SBVA::CNF cnf;
+    SBVA::Config config;
+    cnf.parse_cnf(f, config);
+    fclose(f);
+
+    uint32_t num_vars;
+    uint32_t num_cls;
+    auto ret = cnf.get_cnf(num_vars, num_cls);
+    if (num_vars != 5 || num_cls != 6 || ret != expected) {
+        cout << "ERROR: " << name << " parsed " << num_cls << " clauses:";
+        for (const auto& l : ret) cout << " " << l;
+        cout << endl;
+        return 1;
+    }
+    return 0;
+}
+
+static const char* dup_text =
+    "p cnf 3 6\n"
+    "1 2 0\n"
+    "2 1 0\n"
+    "-3 1 0\n"
+    "1 2 0\n"
+    "3 0\n"
+    "1 -3 0\n";
+
+static const vector<int> dup_expected = {
+    1, 2, 0,
+    -3, 1, 0,
+    3, 0,
+};
+
+static int check_dedup(bool dedup_sort) {
+    FILE* f = tmpfile();
+    if (f == nullptr) {
+        cout << "ERROR: could not open input for dedup" << endl;
+        return 1;
+    }
+    fwrite(dup_text, 1, strlen(dup_text), f);
+    rewind(f);
+    SBVA::CNF cnf;
+    SBVA::Config config;
+    config.dedup_sort = dedup_sort;
+    cnf.parse_cnf(f, config);
+    fclose(f);
+
+    uint32_t num_vars;
+    uint32_t num_cls;
+    auto ret = cnf.get_cnf(num_vars, num_cls);
+    if (num_cls != 3 || ret != dup_expected) {
+        cout << "ERROR: dedup " << (dedup_sort ? "sort" : "hash") << " kept " << num_cls << " clauses:";
+        for (const auto& l : ret) cout << " " << l;
+        cout << endl;
+        return 1;
+    }
+    return 0;
+}
+
+// Large enough to be split over threads. Clauses span and share lines, with
+// comments in between, and the file ends with '%' and garbage after it.
+static std::string make_large_text() {
+    std::string text = "p cnf 1000 60000\n";
+    uint32_t seed = 777;
+    auto rnd = [&]() { seed = seed * 1103515245 + 12345; return (seed >> 16) & 0x7fff; };
+    for (int i = 0; i < 50000; i++) {
+        if (i % 1000 == 0) text += "c comment 1 2 0\n";
+        uint32_t sz = 1 + rnd() % 5;
+        for (uint32_t j = 0; j < sz; j++) {
+            int lit = 1 + rnd() % 1000;
+            if (rnd() & 1) lit = -lit;
+            text += std::to_string(lit);
+            text += (rnd() % 7 == 0) ? "\n" : " ";
+        }
+        text += (rnd() % 3 == 0) ? "0 " : "0\n";
+    }
+    text += "%\n0\n1 2 x\n";
+    return text;
+}
+
+// Everything in file, which is closed
+static std::string contents(FILE* file) {
+    std::string ret;
+    rewind(file);
+    int c;
+    while ((c = fgetc(file)) != EOF) ret += (char)c;
+    fclose(file);
+    return ret;
+}
+
+static int check_threads() {
+    const std::string text = make_large_text();
+    vector<int> ref;
+    std::string ref_text;
+    for (uint32_t threads : {1, 2, 4}) {
+        FILE* f = tmpfile();
+        if (f == nullptr) {
+            cout << "ERROR: could not open input for threads" << endl;
+            return 1;
+        }
+        fwrite(text.data(), 1, text.size(), f);
+        rewind(f);
+        SBVA::CNF cnf;
+        SBVA::Config config;
+        config.num_threads = threads;
+        cnf.parse_cnf(f, config);
+        fclose(f);
+
+        uint32_t num_vars;
+        uint32_t num_cls;
+        auto ret = cnf.get_cnf(num_vars, num_cls);
+        if (threads == 1) ref = ret;
+        if (num_cls == 0 || ret != ref) {
+            cout << "ERROR: " << threads << " threads parsed " << num_cls << " clauses" << endl;
+            return 1;
+        }
+
+        f = tmpfile();
+        if (f == nullptr) {
+            cout << "ERROR: could not open output for threads" << endl;
+            return 1;
+        }
+        cnf.to_cnf(f);
+        const std::string out = contents(f);
+        if (threads == 1) ref_text = out;
+        if (out != ref_text) {
+            cout << "ERROR: " << threads << " threads wrote different output" << endl;
+            return 1;
+        }
+    }
+    return 0;
+}
+
+// The clause view and the export give what get_cnf() does, also with the
+// clauses SBVA deleted still in storage
+static int check_view() {
+    SBVA::CNF cnf;
+    SBVA::Config config;
+    cnf.init_cnf(40, config);
+    // Pairwise at-most-one constraints, which SBVA replaces
+    for (int g = 0; g < 5; g++) {
+        for (int i = 1; i <= 8; i++) {
+            for (int j = i+1; j <= 8; j++) cnf.add_cl({-(g*8+i), -(g*8+j)});
+        }
+    }
+    cnf.finish_cnf();
+    cnf.run(SBVA::Tiebreak::ThreeHop);
+
+    uint32_t num_vars;
+    uint32_t num_cls;
+    const auto ret = cnf.get_cnf(num_vars, num_cls);
+    vector<int> view;
+    uint32_t view_cls = 0;
+    for (const auto& cl : cnf.clauses()) {
+        view.insert(view.end(), cl.begin(), cl.end());
+        view.push_back(0);
+        view_cls++;
+    }
+    vector<int> exported(cnf.export_size());
+    const bool too_small = cnf.export_cnf(exported.data(), exported.size() - 1) != 0;
+    const size_t written = cnf.export_cnf(exported.data(), exported.size());
+    if (view != ret || view_cls != num_cls || cnf.num_clauses() != num_cls || cnf.num_vars() != num_vars
+        || too_small || written != ret.size() || exported != ret)
+    {
+        cout << "ERROR: clause view or export differs from get_cnf(), " << view_cls
+            << " clauses against " << num_cls << endl;
+        return 1;
+    }
+    return 0;
+}
+
+static int check_compression(SBVA::Compression c, const char* name) {
+    if (!SBVA::compression_supported(c)) return 0;
+    FILE* f = tmpfile();
+    if (f == nullptr) {
+        cout << "ERROR: could not open input for " << name << endl;
+        return 1;
+    }
+    fwrite(cnf_text, 1, strlen(cnf_text), f);
+    rewind(f);
+    SBVA::CNF cnf;
+    SBVA::Config config;
+    cnf.parse_cnf(f, config);
+    fclose(f);
+
+    f = tmpfile();
+    if (f == nullptr) {
+        cout << "ERROR: could not open output for " << name << endl;
+        return 1;
+    }
+    cnf.to_cnf(f, c);
+    rewind(f);
+    return check(f, name);
+}
+
+// DIMACS to binary and back must give the same text, and the binary
+// written from the binary input the same bytes
+static int check_binary(SBVA::CnfFormat fmt, const char* name) {
+    FILE* f = tmpfile();
+    if (f == nullptr) {
+        cout << "ERROR: could not open input for " << name << endl;
+        return 1;
+    }
+    fwrite(cnf_text, 1, strlen(cnf_text), f);
+    rewind(f);
+    SBVA::CNF text;
+    SBVA::Config config;
+    text.parse_cnf(f, config);
+    fclose(f);
+
+    FILE* bin = tmpfile();
+    FILE* text_out = tmpfile();
+    FILE* bin_again = tmpfile();
+    FILE* text_again = tmpfile();
+    if (bin == nullptr || text_out == nullptr || bin_again == nullptr || text_again == nullptr) {
+        cout << "ERROR: could not open output for " << name << endl;
+        return 1;
+    }
+    text.to_cnf(bin, SBVA::Compression::None, fmt);
+    text.to_cnf(text_out);
+    rewind(bin);
+    SBVA::CNF binary;
+    SBVA::Config config2;
+    binary.parse_cnf(bin, config2);
+    binary.to_cnf(bin_again, SBVA::Compression::None, fmt);
+    binary.to_cnf(text_again);
+    const std::string bin_s = contents(bin);
+    const std::string bin_again_s = contents(bin_again);
+    const std::string text_s = contents(text_out);
+    const std::string text_again_s = contents(text_again);
+    if (bin_s != bin_again_s || text_s != text_again_s || bin_s.size() >= text_s.size()) {
+        cout << "ERROR: " << name << " round trip differs, binary " << bin_s.size()
+            << " bytes, text " << text_s.size() << " bytes" << endl;
+        return 1;
+    }
+    return 0;
+}
+
+int main() {
+    int ret = 0;
+
+    FILE* f = tmpfile();
+    if (f != nullptr) {
+        fwrite(cnf_text, 1, strlen(cnf_text), f);
+        rewind(f);
+    }
+    ret |= check(f, "file");
+
+#if !defined(_WIN32)
+    // fmemopen() has no file descriptor, so this goes via the buffered path
+    ret |= check(fmemopen((void*)cnf_text, strlen(cnf_text), "r"), "stream");
+#endif
+
+    ret |= check_dedup(false);
+    ret |= check_dedup(true);
+    ret |= check_threads();
+    ret |= check_view();
+    ret |= check_compression(SBVA::Compression::Gzip, "gzip");
+    ret |= check_compression(SBVA::Compression::Xz, "xz");
+    ret |= check_compression(SBVA::Compression::Zstd, "zstd");
+    ret |= check_binary(SBVA::CnfFormat::Binary, "binary");
+    ret |= check_binary(SBVA::CnfFormat::BinaryHashes, "binary with hashes");
+
+    if (ret == 0) cout << "OK" << endl;
+    return ret;
+}
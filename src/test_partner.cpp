@@ -0,0 +1,95 @@
+/******************************************
+Copyright (C) 2024 Mate Soos
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+***********************************************/
+
+// Checks that finding partner clauses through the hash index gives the same
+// result as scanning the occurrence lists, over many replacements.
+
+#include "sbva.h"
+#include <cstdint>
+#include <iostream>
+#include <vector>
+using std::cout;
+using std::endl;
+using std::vector;
+
+static const uint32_t num_vars = 40;
+
+static vector<vector<int>> make_formula() {
+    vector<vector<int>> cls;
+    // Pigeon hole style at-most-one constraints give lots of matches
+    for (int g = 0; g < 4; g++) {
+        for (int i = 1; i <= 6; i++) {
+            for (int j = i+1; j <= 6; j++) {
+                cls.push_back({-(g*6+i), -(g*6+j)});
+            }
+        }
+    }
+    // Longer clauses of mixed sizes, some of them sharing all but one literal
+    uint32_t seed = 12345;
+    auto rnd = [&]() { seed = seed * 1103515245 + 12345; return (seed >> 16) & 0x7fff; };
+    for (int i = 0; i < 300; i++) {
+        vector<int> cl;
+        uint32_t sz = 3 + rnd() % 3;
+        while (cl.size() < sz) {
+            int lit = 25 + rnd() % 16;
+            if (rnd() & 1) lit = -lit;
+            bool dup = false;
+            for (int l : cl) dup |= (l == lit || l == -lit);
+            if (!dup) cl.push_back(lit);
+        }
+        cls.push_back(cl);
+    }
+    return cls;
+}
+
+static vector<int> run(const vector<vector<int>>& cls, bool partner_index, uint32_t& num_cls) {
+    SBVA::Config config;
+    config.partner_index = partner_index;
+    SBVA::CNF cnf;
+    cnf.init_cnf(num_vars, config);
+    for (const auto& cl : cls) cnf.add_cl(cl);
+    cnf.finish_cnf();
+    cnf.run(SBVA::Tiebreak::ThreeHop);
+
+    uint32_t nvars;
+    return cnf.get_cnf(nvars, num_cls);
+}
+
+int main() {
+    auto cls = make_formula();
+    uint32_t num_cls_scan;
+    uint32_t num_cls_index;
+    auto scan = run(cls, false, num_cls_scan);
+    auto index = run(cls, true, num_cls_index);
+
+    if (num_cls_scan >= cls.size()) {
+        cout << "ERROR: no replacements were done" << endl;
+        return 1;
+    }
+    if (scan != index || num_cls_scan != num_cls_index) {
+        cout << "ERROR: partner index gives " << num_cls_index
+            << " clauses, scan gives " << num_cls_scan << endl;
+        return 1;
+    }
+    cout << "OK" << endl;
+    return 0;
+}
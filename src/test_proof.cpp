@@ -0,0 +1,281 @@
+/******************************************
+Copyright (C) 2024 Mate Soos
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+***********************************************/
+
+// Checks the proof written while SBVA runs: it is the same every time it is
+// copied out, it adds every clause of the result that is not in the input,
+// and binary DRAT has the same lines as text. Written to a file while SBVA
+// runs, through set_proof_output(), it is the same in both formats. The
+// built-in checker accepts it in both formats and rejects it when changed,
+// and tells binary from text also when the proof starts with a deletion.
+
+#include "sbva.h"
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <iostream>
+#include <set>
+#include <sstream>
+#include <string>
+#include <vector>
+using std::cout;
+using std::endl;
+using std::set;
+using std::string;
+using std::vector;
+
+// Groups of pairwise at-most-one constraints, which BVA replaces
+static vector<vector<int>> make_formula() {
+    vector<vector<int>> cls;
+    for (int g = 0; g < 5; g++) {
+        for (int i = 1; i <= 6; i++) {
+            for (int j = i+1; j <= 6; j++) {
+                cls.push_back({-(g*6+i), -(g*6+j)});
+            }
+        }
+    }
+    return cls;
+}
+
+static string proof_text(SBVA::CNF& cnf, SBVA::ProofFormat fmt = SBVA::ProofFormat::Drat) {
+    FILE* f = tmpfile();
+    if (f == nullptr) return "";
+    cnf.to_proof(f, SBVA::Compression::None, fmt);
+    string ret;
+    rewind(f);
+    int c;
+    while ((c = fgetc(f)) != EOF) ret += (char)c;
+    fclose(f);
+    return ret;
+}
+
+// The proof of a run that writes it straight to a file
+static string direct_proof(const vector<vector<int>>& cls, SBVA::ProofFormat fmt) {
+    SBVA::Config config;
+    config.generate_proof = true;
+    SBVA::CNF cnf;
+    cnf.init_cnf(30, config);
+    for (const auto& cl : cls) cnf.add_cl(cl);
+    cnf.finish_cnf();
+    FILE* f = tmpfile();
+    if (f == nullptr) return "";
+    cnf.set_proof_output(f, SBVA::Compression::None, fmt);
+    cnf.run(SBVA::Tiebreak::ThreeHop);
+    string ret;
+    rewind(f);
+    int c;
+    while ((c = fgetc(f)) != EOF) ret += (char)c;
+    fclose(f);
+    return ret;
+}
+
+// Binary DRAT as text DRAT
+static string decode_binary(const string& bin) {
+    string ret;
+    size_t i = 0;
+    while (i < bin.size()) {
+        if (bin[i++] == 'd') ret += "d ";
+        while (true) {
+            uint64_t v = 0;
+            for (uint32_t shift = 0; i < bin.size(); shift += 7) {
+                const unsigned char b = bin[i++];
+                v |= (uint64_t)(b & 0x7f) << shift;
+                if (b < 0x80) break;
+            }
+            if (v == 0) break;
+            ret += std::to_string((v & 1) ? -(int64_t)(v >> 1) : (int64_t)(v >> 1)) + " ";
+        }
+        ret += "0\n";
+    }
+    return ret;
+}
+
+static FILE* file_with(const string& text) {
+    FILE* f = tmpfile();
+    if (f == nullptr) return nullptr;
+    fwrite(text.data(), 1, text.size(), f);
+    rewind(f);
+    return f;
+}
+
+static bool verify(const string& input, const string& output, const string& proof, string& error) {
+    FILE* fin = file_with(input);
+    FILE* fout = file_with(output);
+    FILE* fproof = file_with(proof);
+    if (fin == nullptr || fout == nullptr || fproof == nullptr) {
+        error = "could not open temporary files";
+        return false;
+    }
+    SBVA::Config config;
+    const bool ok = SBVA::verify_proof(fin, fout, fproof, config, error);
+    fclose(fin);
+    fclose(fout);
+    fclose(fproof);
+    return ok;
+}
+
+static int check_verify(const vector<vector<int>>& cls, SBVA::CNF& cnf, const string& proof,
+    const string& binary)
+{
+    string input = "p cnf 30 " + std::to_string(cls.size()) + "\n";
+    for (const auto& cl : cls) {
+        for (int lit : cl) input += std::to_string(lit) + " ";
+        input += "0\n";
+    }
+    FILE* f = tmpfile();
+    if (f == nullptr) return 1;
+    cnf.to_cnf(f);
+    string output;
+    rewind(f);
+    int c;
+    while ((c = fgetc(f)) != EOF) output += (char)c;
+    fclose(f);
+
+    string error;
+    if (!verify(input, output, proof, error) || !verify(input, output, binary, error)) {
+        cout << "ERROR: proof not verified: " << error << endl;
+        return 1;
+    }
+
+    // The first clause of the step deleted and added back is still fine
+    const size_t eol = proof.find('\n') + 1;
+    const string readd = proof.substr(0, eol) + "d " + proof.substr(0, eol) + proof;
+    if (!verify(input, output, readd, error)) {
+        cout << "ERROR: proof with a step clause added back not verified: " << error << endl;
+        return 1;
+    }
+
+    // A clause that is not RAT on the fresh variable, after the first line
+    const string first = proof.substr(0, proof.find(' '));
+    const string bad_rat = proof.substr(0, eol) + "-" + first + " 1 0\n" + proof.substr(eol);
+    // A deletion missing
+    const size_t del = proof.find("d ");
+    const string no_del = proof.substr(0, del) + proof.substr(proof.find('\n', del) + 1);
+    for (const string* bad : {&bad_rat, &no_del}) {
+        if (verify(input, output, *bad, error)) {
+            cout << "ERROR: changed proof verified" << endl;
+            return 1;
+        }
+    }
+    return 0;
+}
+
+// A binary proof whose first line deletes a clause starting with literal 16,
+// which is the byte ' ' after the 'd'
+static int check_binary_deletion_first() {
+    const string input = "p cnf 16 2\n16 1 0\n2 3 0\n";
+    const string output = "p cnf 16 1\n2 3 0\n";
+    const string text = "d 16 1 0\n";
+    const string binary("d\x20\x02\x00", 4);
+    string error;
+    if (!verify(input, output, text, error) || !verify(input, output, binary, error)) {
+        cout << "ERROR: proof starting with a deletion not verified: " << error << endl;
+        return 1;
+    }
+    return 0;
+}
+
+int main() {
+    auto cls = make_formula();
+    SBVA::Config config;
+    config.generate_proof = true;
+    SBVA::CNF cnf;
+    cnf.init_cnf(30, config);
+    for (const auto& cl : cls) cnf.add_cl(cl);
+    cnf.finish_cnf();
+    cnf.run(SBVA::Tiebreak::ThreeHop);
+
+    const string proof = proof_text(cnf);
+    if (proof.empty() || proof != proof_text(cnf)) {
+        cout << "ERROR: proof is empty or changes when copied out again" << endl;
+        return 1;
+    }
+    const string binary = proof_text(cnf, SBVA::ProofFormat::BinaryDrat);
+    if (decode_binary(binary) != proof || binary.size() >= proof.size()) {
+        cout << "ERROR: binary proof differs from text, " << binary.size()
+            << " bytes against " << proof.size() << endl;
+        return 1;
+    }
+
+    const string direct = direct_proof(cls, SBVA::ProofFormat::Drat);
+    const string direct_binary = direct_proof(cls, SBVA::ProofFormat::BinaryDrat);
+    if (direct != proof || direct_binary != binary) {
+        cout << "ERROR: proof written while running differs from the copied one" << endl;
+        return 1;
+    }
+
+    if (check_verify(cls, cnf, proof, binary)) return 1;
+    if (check_binary_deletion_first()) return 1;
+
+    // Every proof line is a clause ended by 0, additions of the result's new
+    // clauses and deletions
+    set<vector<int>> added;
+    std::istringstream in(proof);
+    string line;
+    while (std::getline(in, line)) {
+        std::istringstream ls(line);
+        string first;
+        ls >> first;
+        vector<int> lits;
+        const bool deletion = first == "d";
+        if (!deletion) lits.push_back(std::stoi(first));
+        int lit;
+        while (ls >> lit && lit != 0) lits.push_back(lit);
+        if (lit != 0) {
+            cout << "ERROR: proof line not ended by 0: " << line << endl;
+            return 1;
+        }
+        std::sort(lits.begin(), lits.end());
+        if (!deletion) added.insert(lits);
+    }
+
+    set<vector<int>> input;
+    for (auto cl : cls) {
+        std::sort(cl.begin(), cl.end());
+        input.insert(cl);
+    }
+    uint32_t num_vars;
+    uint32_t num_cls;
+    auto ret = cnf.get_cnf(num_vars, num_cls);
+    vector<int> cl;
+    uint32_t new_cls = 0;
+    for (int lit : ret) {
+        if (lit != 0) {
+            cl.push_back(lit);
+            continue;
+        }
+        std::sort(cl.begin(), cl.end());
+        if (!input.count(cl)) {
+            new_cls++;
+            if (!added.count(cl)) {
+                cout << "ERROR: clause of the result is not in the proof" << endl;
+                return 1;
+            }
+        }
+        cl.clear();
+    }
+    if (new_cls == 0) {
+        cout << "ERROR: no replacements were done" << endl;
+        return 1;
+    }
+    cout << "OK" << endl;
+    return 0;
+}